@@ -7,6 +7,18 @@
 */
 
 #include "MiniMat.hpp"
+#include "MiniMatDiag.hpp"
+#include "MiniMatBand.hpp"
+#include "MiniMatSparse.hpp"
+#include "MiniMatSpSolve.hpp"
+#include "MiniMatKrylov.hpp"
+#include "MiniMatFixed.hpp"
+#include "MiniMatMixed.hpp"
+#include "MiniMatHalf.hpp"
+#include "MiniMatBits.hpp"
+#include "MiniMatMath.hpp"
+#include "MiniMatBatch.hpp"
+#include "MiniMatSoA.hpp"
 
 int main()
 {
@@ -140,4 +152,642 @@ int main()
 	//TMat1=TTemp1;//This command will also clean TTemp1 (See Note in the Header);
 	MiniMat_HeapScope.Print();
 	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 8: Diagonal Matrix Multiply, Solve, Determinant and Transpose (Checked against Full Matrix)
+	cout<<">>Example 8:"<<endl<<endl;
+	DefDiag(double,TDiag,5);
+	DefDiag(double,TDiag2,5);
+	DefEye(double,TEye,5);
+	TDiag>>0<<2,4,5,8,10;
+	TmpMat(double,TDiagRef,5,5);
+	TmpMat(double,TDiagOut,5,5);
+	cout<<"Diagonal Matrix:";
+	TDiag.Print();
+	TDiagRef=Full(TDiag)*TMat1;
+	TDiagOut=TDiag*TMat1;
+	cout<<"Difference of Diagonal Multiply from Full Multiply: "<<Max(Abs(TDiagOut-TDiagRef))<<endl;
+	TDiagRef=(!Full(TDiag))*TMat1;
+	TDiagOut=Solve(TDiag,TMat1);
+	cout<<"Difference of Diagonal Solve from Full Inverse: "<<Max(Abs(TDiagOut-TDiagRef))<<endl;
+	TDiagOut=TEye*TMat1;
+	cout<<"Difference of Identity Multiply from Base Matrix: "<<Max(Abs(TDiagOut-TMat1))<<endl;
+	cout<<"Determinant of Diagonal Matrix: "<<Det(TDiag)<<"\tDeterminant of Full Matrix: "<<Det(Full(TDiag))<<endl;
+	TDiag2=TDiag.Trans();
+	TDiagOut=Full(TDiag2)-Full(TDiag);
+	cout<<"Difference of Transpose from Diagonal Matrix: "<<Max(Abs(TDiagOut))<<endl;
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 9: Band and Tridiagonal Solve (Checked against Inverse of the Dense Matrix)
+	cout<<">>Example 9:"<<endl<<endl;
+	TmpMat(double,TSys,6,6);
+	TSys>>0		<<4,1,2,0,0,0,
+				  2,5,1,1,0,0,
+				  0,1,6,2,1,0,
+				  0,0,3,7,1,2,
+				  0,0,0,1,5,1,
+				  0,0,0,0,2,6;
+	TmpMat(double,TRhs,6,1);
+	TRhs>>0<<1,2,3,4,5,6;
+	TmpMat(double,TSolRef,6,1);
+	TmpMat(double,TSol,6,1);
+	TSolRef=(!TSys)*TRhs;
+	cout<<"Solution from Dense Inverse:";
+	TSolRef.Print();
+	DefBand(double,TBand,6,1,2);
+	TBand=TSys;
+	TSol=TRhs;
+	TBand.Solve(TSol.Pt());
+	cout<<"Difference of Band LU Solve: "<<Max(Abs(TSol-TSolRef))<<endl;
+	TBand(1,1,100);
+	TSol=Solve(TBand,TRhs);
+	cout<<"Difference after Edit on Factored Band (Ignored): "<<Max(Abs(TSol-TSolRef))<<endl;
+	TmpMat(double,TSing,6,6);
+	TSing=TSys;
+	TSing(2,1,0);
+	TSing(2,2,0);
+	TSing(2,3,0);
+	TSing(2,4,0);
+	TBand=TSing;
+	TSol=Solve(TBand,TRhs);
+	cout<<"Singular Band Solve (0s, Factored "<<TBand.Factored()<<"):";
+	TSol.Print();
+	DefTri(double,TTri,6);
+	TTri.Set(-1,4,-1);
+	TmpMat(double,TTriDense,6,6);
+	TTriDense=0;
+	u8 ii;
+	for(ii=1;ii<=6;ii++)
+	{
+		TTriDense(ii,ii,4);
+		if(ii>1)
+		{
+			TTriDense(ii,ii-1,-1);
+			TTriDense(ii-1,ii,-1);
+		}
+	}
+	TSolRef=(!TTriDense)*TRhs;
+	TSol=TRhs;
+	TTri.Solve(TSol.Pt());
+	cout<<"Difference of Tridiagonal Solve: "<<Max(Abs(TSol-TSolRef))<<endl;
+	TTri(3,3,5);
+	TTriDense(3,3,5);
+	TSolRef=(!TTriDense)*TRhs;
+	TSol=Solve(TTri,TRhs);
+	cout<<"Difference of Tridiagonal Solve after Edit (Refactored): "<<Max(Abs(TSol-TSolRef))<<endl;
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 10: Sparse Matrix Multiply and Transposed Multiply in CSR and CSC (Checked against Dense Results)
+	cout<<">>Example 10:"<<endl<<endl;
+	DefSpMat(double,TSpA,6,6,36);
+	DefSpMat(double,TSpC,6,6,36);
+	TSpA.FromMat(TSys);
+	Convert(TSpA,TSpC,1);
+	cout<<"Nonzeros of Sparse Matrix: "<<TSpA.Nz()<<endl;
+	TSolRef=TSys*TRhs;
+	TSpA.Mult(TRhs.Pt(),TSol.Pt());
+	cout<<"Difference of CSR Multiply: "<<Max(Abs(TSol-TSolRef))<<endl;
+	TSpC.Mult(TRhs.Pt(),TSol.Pt());
+	cout<<"Difference of CSC Multiply: "<<Max(Abs(TSol-TSolRef))<<endl;
+	TSolRef=(~TSys)*TRhs;
+	TSpA.MultTrans(TRhs.Pt(),TSol.Pt());
+	cout<<"Difference of CSR Transposed Multiply: "<<Max(Abs(TSol-TSolRef))<<endl;
+	TSpC.MultTrans(TRhs.Pt(),TSol.Pt());
+	cout<<"Difference of CSC Transposed Multiply: "<<Max(Abs(TSol-TSolRef))<<endl;
+	cout<<"Still CSR after Transposed Multiply: "<<!TSpA.CSC()<<"	Size: "<<TSpA.Ro()<<"x"<<TSpA.Co()<<endl;
+	cout<<"Compress from Wrong Size (0 Expected): "<<TSpA.FromMat(TRhs)<<endl;
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 11: Sparse Cholesky and Sparse LU (Checked against Inverse of the Dense Matrix, Arrow Matrix Checked by Residual)
+	cout<<">>Example 11:"<<endl<<endl;
+	TmpMat(double,TSpd,6,6);
+	TSpd>>0		<<4,-1,0,0,-1,0,
+				  -1,4,-1,0,0,-1,
+				  0,-1,4,-1,0,0,
+				  0,0,-1,4,-1,0,
+				  -1,0,0,-1,4,-1,
+				  0,-1,0,0,-1,4;
+	DefSpMat(double,TSpS,6,6,36);
+	TSpS.FromMat(TSpd);
+	SpChol<double> TChol;
+	TSolRef=(!TSpd)*TRhs;
+	TSol=TRhs;
+	if(TChol.Analyze(TSpS)&&TChol.Factor(TSpS)&&TChol.Solve(TSol.Pt()))
+	{
+		cout<<"Difference of Sparse Cholesky Solve: "<<Max(Abs(TSol-TSolRef))<<endl;
+	}
+	TChol.CleanTmp();
+	SpLU<double> TLU;
+	TSolRef=(!TSys)*TRhs;
+	TSol=TRhs;
+	if(TLU.Analyze(TSpA)&&TLU.Factor(TSpA)&&TLU.Solve(TSol.Pt()))
+	{
+		cout<<"Difference of Sparse LU Solve: "<<Max(Abs(TSol-TSolRef))<<endl;
+	}
+	TLU.CleanTmp();
+	TmpMat(double,TArrow,20,20);
+	TmpMat(double,TArrowRhs,20,1);
+	TmpMat(double,TArrowSol,20,1);
+	TArrow=0;
+	for(ii=1;ii<=20;ii++)
+	{
+		TArrow(ii,ii,1e-6);
+		TArrow(1,ii,ii);
+		if(ii<20)
+		{
+			TArrow(ii,ii+1,1);
+		}
+		TArrowRhs(ii,1,ii%3);
+	}
+	DefSpMat(double,TSpArrow,20,20,400);
+	TSpArrow.FromMat(TArrow);
+	TArrowSol=TArrowRhs;
+	if(TLU.Analyze(TSpArrow)&&TLU.Factor(TSpArrow)&&TLU.Solve(TArrowSol.Pt()))
+	{
+		cout<<"Residual of Sparse LU Solve on Arrow Matrix: "<<Max(Abs(TArrow*TArrowSol-TArrowRhs))<<endl;
+	}
+	else
+	{
+		cout<<"Sparse LU on Arrow Matrix Refused (Off Diagonal Pivots Need More Storage than Analyzed)"<<endl;
+	}
+	TLU.CleanTmp();
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 12: Krylov Iterative Solvers (Checked against Inverse of the Dense Matrix)
+	cout<<">>Example 12:"<<endl<<endl;
+	LinOp<double> TOpS(TSpS);
+	LinOp<double> TOpA(TSpA);
+	Krylov<double> TKrylov(1e-10,100);
+	TSolRef=(!TSpd)*TRhs;
+	TSol=0;
+	cout<<"Conjugate Gradient: ";
+	TKrylov.CG(TOpS,TRhs.Pt(),TSol.Pt()).Print();
+	cout<<"Difference of Conjugate Gradient: "<<Max(Abs(TSol-TSolRef))<<endl;
+	TSolRef=(!TSys)*TRhs;
+	TSol=0;
+	cout<<"BiCGSTAB: ";
+	TKrylov.BiCGSTAB(TOpA,TRhs.Pt(),TSol.Pt()).Print();
+	cout<<"Difference of BiCGSTAB: "<<Max(Abs(TSol-TSolRef))<<endl;
+	TSol=0;
+	cout<<"GMRES: ";
+	TKrylov.GMRES(TOpA,TRhs.Pt(),TSol.Pt()).Print();
+	cout<<"Difference of GMRES: "<<Max(Abs(TSol-TSolRef))<<endl;
+	Krylov<double> TKrylovZero(1e-10,100,0);
+	TSol=0;
+	cout<<"GMRES with Restart 0 (Taken as 1): ";
+	TKrylovZero.GMRES(TOpS,TRhs.Pt(),TSol.Pt()).Print();
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 13: Multiply of Non Square Matrixes (Checked Element by Element)
+	cout<<">>Example 13:"<<endl<<endl;
+	TmpMat(double,TWideL,2,3);
+	TmpMat(double,TWideR,3,4);
+	TmpMat(double,TWideOut,2,4);
+	TWideL>>0	<<1,2,3,
+				  4,5,6;
+	TWideR>>0	<<1,0,-1,2,
+				  0,1,2,-1,
+				  3,1,0,1;
+	TWideOut=TWideL*TWideR;
+	cout<<"Product of 2x3 and 3x4:";
+	TWideOut.Print();
+	double TDotErr=0;
+	u8 jj;
+	for(ii=1;ii<=2;ii++)
+	{
+		for(jj=1;jj<=4;jj++)
+		{
+			TDotErr+=fabs(TWideOut(ii,jj)-Point(~TWideL(ii,ii,1,3),TWideR(1,3,jj,jj)));
+		}
+	}
+	cout<<"Difference from Row Column Point Products: "<<TDotErr<<endl;
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 14: Fixed Point Multiply, Scaled Solve and Saturation (Checked against Double)
+	cout<<">>Example 14:"<<endl<<endl;
+	TmpMat(Q15,TQ1,3,3);
+	TmpMat(Q15,TQ2,3,3);
+	TmpMat(Q15,TQOut,3,3);
+	TmpMat(double,TQRef1,3,3);
+	TmpMat(double,TQRef2,3,3);
+	TmpMat(double,TQCheck,3,3);
+	TQRef1>>0	<<0.5,-0.25,0.125,
+				  0.25,0.75,-0.5,
+				  -0.125,0.25,0.625;
+	TQRef2>>0	<<0.3,0.1,-0.2,
+				  -0.4,0.6,0.2,
+				  0.1,-0.3,0.5;
+	for(ii=1;ii<=3;ii++)
+	{
+		for(jj=1;jj<=3;jj++)
+		{
+			TQ1(ii,jj,Q15(TQRef1(ii,jj)));
+			TQ2(ii,jj,Q15(TQRef2(ii,jj)));
+		}
+	}
+	TQOut=TQ1*TQ2;
+	for(ii=1;ii<=3;ii++)
+	{
+		for(jj=1;jj<=3;jj++)
+		{
+			TQCheck(ii,jj,TQOut(ii,jj).Dbl());
+		}
+	}
+	cout<<"Q15 Product:";
+	TQOut.Print();
+	cout<<"Difference of Q15 Multiply from Double: "<<Max(Abs(TQCheck-TQRef1*TQRef2))<<endl;
+	s16 TQExp;
+	TQOut=Solve(TQ1,TQ2,TQExp);
+	for(ii=1;ii<=3;ii++)
+	{
+		for(jj=1;jj<=3;jj++)
+		{
+			TQCheck(ii,jj,ldexp(TQOut(ii,jj).Dbl(),TQExp));
+		}
+	}
+	cout<<"Difference of Q15 Solve from Double Inverse: "<<Max(Abs(TQCheck-(!TQRef1)*TQRef2))<<endl;
+	cout<<"Saturated Q15 Sum of 0.75 and 0.5: "<<Q15(0.75)+Q15(0.5)<<"	Saturated Q31 Difference of -0.75 and 0.5: "<<Q31(-0.75)-Q31(0.5)<<endl;
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 15: Mixed Precision Multiply and Point Product (Checked against Double)
+	cout<<">>Example 15:"<<endl<<endl;
+	TmpMat(s8,TNarrow1,2,3);
+	TmpMat(s8,TNarrow2,3,2);
+	TmpMat(s32,TMixOut,2,2);
+	TNarrow1>>0	<<100,-120,127,
+				  90,110,-128;
+	TNarrow2>>0	<<127,100,
+				  -128,90,
+				  120,-110;
+	TMixOut=MultWide<s32>(TNarrow1,TNarrow2);
+	cout<<"s8 Product Accumulated in s32:";
+	TMixOut.Print();
+	TmpMat(float,TFltVec1,1,4);
+	TmpMat(float,TFltVec2,1,4);
+	TFltVec1>>0<<1e8,1,-1e8,1;
+	TFltVec2>>0<<1,1,1,1;
+	cout<<"Float Point Product Accumulated in Double: "<<PointWide<double>(TFltVec1,TFltVec2)<<"	Accumulated in Float: "<<Point(TFltVec1,TFltVec2)<<endl;
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 16: Half Precision Storage (Checked against Float)
+	cout<<">>Example 16:"<<endl<<endl;
+	TmpMat(float,TFlt1,4,4);
+	TmpMat(float,TFlt2,4,4);
+	TmpMat(float,TFltOut,4,4);
+	TmpMat(Half,THalf1,4,4);
+	TFlt1>>0	<<1.5,-2,0.3,3,
+				  0.5,1.1,-1.25,2,
+				  -3,0.75,2,1,
+				  2,-0.5,1,-1;
+	TFlt2>>0	<<0.2,1.1,-0.7,0.4,
+				  -1.3,0.6,0.9,-0.2,
+				  0.8,-0.4,1.5,0.3,
+				  0.1,0.9,-0.6,1.2;
+	THalf1=ToHalf<Half>(TFlt1);
+	cout<<"Matrix Stored in Half:";
+	THalf1.Print();
+	TFltOut=MultHalf(THalf1,TFlt2);
+	cout<<"Difference of Half Multiply from Float: "<<Max(Abs(TFltOut-TFlt1*TFlt2))<<endl;
+	TmpMat(BHalf,TBHalf1,4,4);
+	TBHalf1=ToHalf<BHalf>(TFlt1);
+	TFltOut=MultHalf(TBHalf1,TFlt2);
+	cout<<"Difference of BHalf Multiply from Float: "<<Max(Abs(TFltOut-TFlt1*TFlt2))<<endl;
+	TmpMat(float,TFltVecIn,4,1);
+	TmpMat(float,TFltVecOut,4,1);
+	TFltVecIn>>0<<1,-1,0.5,2;
+	GemvHalf(THalf1,TFltVecIn.Pt(),TFltVecOut.Pt());
+	cout<<"Difference of Half Matrix Vector Multiply from Float: "<<Max(Abs(TFltVecOut-TFlt1*TFltVecIn))<<endl;
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 17: Bit Packed Boolean Matrix Logic (Checked against Element Count)
+	cout<<">>Example 17:"<<endl<<endl;
+	DefBits(TGridA,100,100);
+	DefBits(TGridB,100,100);
+	DefBits(TGridOut,100,100);
+	TGridA=0;
+	TGridB=0;
+	u16 TGridRow,TGridCol;
+	for(TGridRow=1;TGridRow<=100;TGridRow++)
+	{
+		for(TGridCol=1;TGridCol<=100;TGridCol++)
+		{
+			TGridA(TGridRow,TGridCol,(TGridRow+TGridCol)%2==0);
+			TGridB(TGridRow,TGridCol,TGridRow<=30);
+		}
+	}
+	cout<<"Memory Space of 100x100 BitMat: "<<TGridA.Sp()<<endl;
+	cout<<"Checkerboard Count: "<<TGridA.Count()<<"	Top Rows Count: "<<TGridB.Count()<<endl;
+	TGridOut=TGridA&TGridB;
+	cout<<"AND Count: "<<TGridOut.Count()<<"	";
+	TGridOut=TGridA|TGridB;
+	cout<<"OR Count: "<<TGridOut.Count()<<"	";
+	TGridOut=TGridA^TGridB;
+	cout<<"XOR Count: "<<TGridOut.Count()<<endl;
+	cout<<"Verification of AND+OR from Counts: "<<Count(TGridA&TGridB)+Count(TGridA|TGridB)<<"	"<<TGridA.Count()+TGridB.Count()<<endl;
+	TGridOut=TGridA|Neg(TGridA);
+	cout<<"Checkerboard OR its Negative, All: "<<TGridOut.All()<<"	Any of Checkerboard AND its Negative: "<<Any(TGridA&TGridA.Neg())<<endl;
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 18: Packed Comparison Masks, Where and MaskedSet (Checked against Element Count)
+	cout<<">>Example 18:"<<endl<<endl;
+	DefBits(TBits,5,5);
+	TmpMat(double,TMasked,5,5);
+	TBits=Gt(TMat1,4.0);
+	cout<<"Mask of Base Matrix Bigger than 4:";
+	TBits.Print();
+	cout<<"Base Matrix where Bigger than 4 and 0 Otherwise:";
+	TMasked=Where(TBits,TMat1,0.0);
+	TMasked.Print();
+	cout<<"Elements Bigger than 4: "<<TBits.Count()<<endl;
+	cout<<"Verification with Elements No Bigger than 4: "<<TBits.Count()+Count(Le(TMat1,4.0))<<endl;
+	TMasked=TMat1;
+	TMasked.MaskedSet(Lt(TMat1,3.0),3.0);
+	cout<<"Base Matrix Clamped to at Least 3 by MaskedSet, Elements below 3: "<<Count(Lt(TMasked,3.0))<<"	Min: "<<Min(TMasked)<<endl;
+	cout<<"Elements Unchanged by MaskedSet: "<<Count(Eq(TMasked,TMat1))<<"	Verification with Elements No Less than 3: "<<Count(Ge(TMat1,3.0))<<endl;
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 19: Reductions, Fused MinMax with Positions and Overflow Safe Norm (Checked against Element Loops)
+	cout<<">>Example 19:"<<endl<<endl;
+	TmpMat(double,TRed,3,4);
+	TRed>>0		<<3,-7,2,9,
+				  1,9,-4,0,
+				  -7,5,6,2;
+	double TRedMin,TRedMax;
+	u16 TArgMin,TArgMax;
+	TRed.MinMax(TRedMin,TRedMax,TArgMin,TArgMax);
+	cout<<"Min: "<<TRedMin<<" at "<<TArgMin<<"	Max: "<<TRedMax<<" at "<<TArgMax<<"	(First Positions, Row Major from 1)"<<endl;
+	cout<<"ArgMin: "<<TRed.ArgMin()<<"	ArgMax: "<<TRed.ArgMax()<<endl;
+	double TLoopSum=0;
+	for(ii=1;ii<=3;ii++)
+	{
+		for(jj=2;jj<=3;jj++)
+		{
+			TLoopSum+=TRed(ii,jj);
+		}
+	}
+	cout<<"Sum: "<<Sum(TRed)<<"	Sum of Columns 2 to 3: "<<TRed.Sum(1,3,2,3)<<"	Verification by Loop: "<<TLoopSum<<endl;
+	cout<<"Max of Rows 2 to 3, Columns 1 to 2: "<<TRed.Max(2,3,1,2)<<"	Min of the Same Part: "<<TRed.Min(2,3,1,2)<<endl;
+	TmpMat(double,THuge,1,2);
+	THuge>>0<<3e200,4e200;
+	cout<<"Norm of (3e200,4e200): "<<Norm(THuge)<<"	Norm of (3,4): "<<Norm(THuge*1e-200)<<endl;
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 20: Row and Column Reductions and Vector Broadcasting (Checked against Partial Matrix Reductions)
+	cout<<">>Example 20:"<<endl<<endl;
+	cout<<"Row Sums:";
+	RowSum(TRed).Print();
+	cout<<"Column Means:";
+	ColMean(TRed).Print();
+	cout<<"Difference of Row Max and Column Min from Partial Matrix: "<<fabs(RowMax(TRed)(2,1)-TRed.Max(2,2,1,4))+fabs(ColMin(TRed)(1,3)-TRed.Min(1,3,3,3))<<endl;
+	cout<<"Difference of Column Norm from Partial Matrix: "<<fabs(ColNorm(TRed)(1,2)-TRed.Norm(1,3,2,2))<<endl;
+	cout<<"Centered by Column Means (Column Sums should be 0):";
+	ColSum(TRed-ColMean(TRed)).Print();
+	cout<<"Rows Scaled by 1/Row Max:";
+	BcDiv(TRed,RowMax(TRed)).Print();
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 21: Hadamard Product, Element-wise Devide and Fused Multiply Plus (Checked against Element Loops)
+	cout<<">>Example 21:"<<endl<<endl;
+	TmpMat(double,TEleA,3,4);
+	TmpMat(double,TEleB,3,4);
+	TmpMat(double,TEleOut,3,4);
+	TEleA=TRed+10.0;
+	TEleB=TRed*0.5+5.0;
+	double TEleErr=0;
+	TEleOut=FMA(TEleA,TEleB,TRed);
+	for(ii=1;ii<=3;ii++)
+	{
+		for(jj=1;jj<=4;jj++)
+		{
+			TEleErr+=fabs(TEleOut(ii,jj)-(TEleA(ii,jj)*TEleB(ii,jj)+TRed(ii,jj)));
+		}
+	}
+	cout<<"Difference of FMA from Element Loop: "<<TEleErr<<endl;
+	cout<<"Difference of Hadamard then EleDiv from Original: "<<Max(Abs(EleDiv(Hadamard(TEleA,TEleB),TEleB)-TEleA))<<endl;
+	cout<<"Difference of FMA from Hadamard Plus: "<<Max(Abs(TEleOut-(Hadamard(TEleA,TEleB)+TRed)))<<endl;
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 22: In Place Scal, Axpy, Axpby, Gemv and Gemm without Temp Mat (Checked against Operators)
+	cout<<">>Example 22:"<<endl<<endl;
+	TmpMat(double,TBlasY,3,4);
+	TmpMat(double,TBlasVec,4,1);
+	TmpMat(double,TBlasOut,3,1);
+	TmpMat(double,TBlasGemm,3,3);
+	TBlasY=TEleA;
+	TBlasY.Scal(2.0).Axpy(-1.5,TEleB);
+	cout<<"Difference of Scal and Axpy from Operators: "<<Max(Abs(TBlasY-(TEleA*2.0-TEleB*1.5)))<<endl;
+	TBlasY.Axpby(0.5,TRed,-2.0);
+	cout<<"Difference of Axpby from Operators: "<<Max(Abs(TBlasY-(TRed*0.5-(TEleA*2.0-TEleB*1.5)*2.0)))<<endl;
+	TBlasVec>>0<<1,-2,0.5,3;
+	TBlasOut>>0<<1,1,1;
+	TBlasOut.Gemv(2.0,TRed,TBlasVec,3.0);
+	cout<<"Difference of Gemv from Operators: "<<Max(Abs(TBlasOut-(TRed*TBlasVec*2.0+3.0)))<<endl;
+	TBlasGemm=0;
+	TBlasGemm.Gemm(1.0,TRed,~TEleA,0.0);
+	cout<<"Difference of Gemm from Operators: "<<Max(Abs(TBlasGemm-TRed*(~TEleA)))<<endl;
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 23: Element-wise Math Functions in Accurate and Fast Mode (Checked against the Standard Library)
+	cout<<">>Example 23:"<<endl<<endl;
+	TmpMat(float,TAngle,2,4);
+	TAngle>>0	<<-3.5,-0.25,0.5,2,
+				  10,100,1000,10000;
+	cout<<"Difference of Fast Sin from Accurate: "<<Max(Abs(Sin(TAngle,_MATH_FAST)-Sin(TAngle,_MATH_ACCURATE)))<<endl;
+	cout<<"Difference of Fast Cos from Accurate: "<<Max(Abs(Cos(TAngle,_MATH_FAST)-Cos(TAngle,_MATH_ACCURATE)))<<endl;
+	cout<<"Difference of Fast Tanh from Accurate: "<<Max(Abs(Tanh(TAngle,_MATH_FAST)-Tanh(TAngle,_MATH_ACCURATE)))<<endl;
+	TmpMat(float,TPositive,1,4);
+	TPositive>>0<<0.001,0.5,3,1e30;
+	cout<<"Norm of Difference of Fast Log from Accurate: "<<Norm(Log(TPositive,_MATH_FAST)-Log(TPositive,_MATH_ACCURATE))<<endl;
+	cout<<"Relative Difference of Fast Exp of Log from Original: "<<Max(Abs(EleDiv(Exp(Log(TPositive,_MATH_FAST),_MATH_FAST)-TPositive,TPositive)))<<endl;
+	TmpMat(float,TSpecial,1,4);
+	TSpecial>>0<<std::numeric_limits<float>::infinity(),-std::numeric_limits<float>::infinity(),std::numeric_limits<float>::quiet_NaN(),0;
+	cout<<"Fast Exp of inf, -inf, NaN, 0:";
+	Exp(TSpecial,_MATH_FAST).Print();
+	cout<<"Fast Log of inf, -inf, NaN, 0:";
+	Log(TSpecial,_MATH_FAST).Print();
+	cout<<"Fast Sin of inf, -inf, NaN, 0:";
+	Sin(TSpecial,_MATH_FAST).Print();
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 24: Operation Counters (Compile with -D_MATPROFILE=1)
+	cout<<">>Example 24:"<<endl<<endl;
+#if _HEAPSCOPE&&_MATPROFILE
+	MiniMat_HeapScope.ResetOps();
+	TBlasGemm=TRed*(~TEleA);
+	TBlasGemm=TBlasGemm*TBlasGemm;
+	cout<<"Multiply Calls: "<<MiniMat_HeapScope.Op(_PROF_MULT).Calls<<"\tFlops: "<<MiniMat_HeapScope.Op(_PROF_MULT).Flops;
+	cout<<"\t(Expected "<<2*3*4*3+2*3*3*3<<")"<<endl;
+	cout<<"Transpose Calls: "<<MiniMat_HeapScope.Op(_PROF_TRANS).Calls<<"\tAllocations: "<<MiniMat_HeapScope.Op(_PROF_TRANS).Allocs<<endl;
+	MiniMat_HeapScope.Print();
+#else
+	cout<<"Operation Counters are Compiled Out (_MATPROFILE is 0)"<<endl;
+#endif
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 25: Scoped Heap Tracking with Nested Peaks
+	cout<<">>Example 25:"<<endl;
+#if _HEAPSCOPE
+	{
+		MiniMat_HeapTrack TTrackOuter;
+		TBlasGemm=TRed*(~TEleA)+TBlasGemm;
+		{
+			MiniMat_HeapTrack TTrackInner;
+			TmpMat(double,TTrackBig,10,10);
+			TTrackBig=0;
+			TBlasGemm=TRed*(~TEleA)+TBlasGemm;
+			cout<<"Outer Peak while Inner is Live: "<<TTrackOuter.PeakByte()<<"\tInner Peak: "<<TTrackInner.PeakByte()<<endl;
+			TTrackInner.Print("Inner Scope (One 10x10 Temp Kept)");
+		}
+		TTrackOuter.Print("Outer Scope");
+		cout<<"Outer within 2000 Bytes: "<<TTrackOuter.Within(2000)<<"\tWithin 900 Bytes: "<<TTrackOuter.Within(900)<<endl;
+	}
+#else
+	cout<<"Heap Tracking is Compiled Out (_HEAPSCOPE is 0)"<<endl;
+#endif
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 26: Call Site Leak Tracing (Compile with -D_HEAPTRACE=1)
+	cout<<">>Example 26:"<<endl;
+#if _HEAPSCOPE&&_HEAPTRACE
+	{
+		MatSite;
+		TmpMat(double,TSiteKept,4,4);
+		TSiteKept=1;
+		TBlasGemm=TRed*(~TEleA);
+		MiniMat_HeapScope.LeakReport();
+	}
+#else
+	cout<<"Call Site Tracing is Compiled Out (_HEAPTRACE is 0)"<<endl;
+#endif
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 27: Operation Timeline (Compile with -D_MATPROFILE=1 -D_MATTIMELINE=1)
+	cout<<">>Example 27:"<<endl<<endl;
+#if _HEAPSCOPE&&_MATPROFILE&&_MATTIMELINE
+	MiniMat_TraceClear();
+	TBlasGemm=TRed*(~TEleA);
+	MiniMat_TraceDump(cout);
+	cout<<"Trace File Written: "<<MiniMat_TraceDump("MiniMatTrace.json")<<endl;
+#else
+	cout<<"Operation Timeline is Compiled Out (_MATTIMELINE is 0)"<<endl;
+#endif
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 28: Shared Heap Counters (Compile with -D_HEAPATOMIC=1 -fopenmp to Allocate from Several Threads)
+	cout<<">>Example 28:"<<endl<<endl;
+#if _HEAPSCOPE
+	{
+		MiniMat_HeapTrack TTrackShared;
+		s32 kk;
+	#if _HEAPATOMIC&&defined(_OPENMP)
+		#pragma omp parallel for schedule(static)
+	#endif
+		for(kk=0;kk<400;kk++)
+		{
+			TmpMat(double,TShared,3,3);
+			TShared=(double) kk;
+			TShared.CleanTmp();
+		}
+		cout<<"Temp Mats Allocated: "<<TTrackShared.AllocNum()<<" (Expected 400)\tBytes: "<<TTrackShared.AllocByte()<<" (Expected "<<400*9*sizeof(double)<<")";
+		cout<<"\tNet Temp Mats: "<<TTrackShared.NetTempNum()<<endl;
+	}
+#else
+	cout<<"Heap Counters are Compiled Out (_HEAPSCOPE is 0)"<<endl;
+#endif
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 29: Arena for Temp Mats (Compile with -D_MATARENA=1)
+	cout<<">>Example 29:"<<endl<<endl;
+#if _MATARENA
+	{
+		MiniMat_Arena TArena(1024);
+		TBlasGemm=TRed*(~TEleA);
+		cout<<"After a Product: Used "<<TArena.Used()<<"\tPeak "<<TArena.Peak()<<"\tLive "<<TArena.Live()<<endl;
+		TmpMat(double,TArenaKept,4,4);
+		TArenaKept=2;
+		cout<<"Reset with a Live Temp: "<<TArena.Reset()<<"\tUsed "<<TArena.Used()<<endl;
+		TArenaKept.CleanTmp();
+		cout<<"Reset after Cleaning: "<<TArena.Reset()<<"\tUsed "<<TArena.Used()<<"\tPeak "<<TArena.Peak()<<endl;
+		TmpMat(double,TArenaBig,20,20);
+		TArenaBig=1;
+		cout<<"20x20 Temp Sent to malloc: "<<TArena.Fallback()<<"\tUsed "<<TArena.Used()<<endl;
+		TArenaBig.CleanTmp();
+	}
+#else
+	cout<<"Arena is Compiled Out (_MATARENA is 0)"<<endl;
+#endif
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 30: Batch Inverse against Lane-wise SoA Det, Inv and Solve (Third 3*3 Matrix is Singular)
+	cout<<">>Example 30:"<<endl<<endl;
+	double TBatchA[3][9]={{2,1,0,1,3,1,0,1,4},{5,2,1,2,6,2,1,2,7},{1,2,3,2,4,6,0,1,1}};
+	double TBatchB[3][3]={{1,2,3},{4,5,6},{7,8,9}};
+	double TBatchInv[3][9];
+	double TBatchDet[3],TSoADet[3];
+	double TBatch4[2][16]={{4,1,0,0,1,4,1,0,0,1,4,1,0,0,1,4},{2,0,0,1,0,3,0,0,0,0,1,0,1,0,0,2}};
+	DefSoA(double,TSoAA,3,3,3);
+	DefSoA(double,TSoAInv,3,3,3);
+	DefSoA(double,TSoAB,3,1,3);
+	DefSoA(double,TSoAX,3,1,3);
+	DefSoA(double,TSoA4,4,4,2);
+	DefSoA(double,TSoA4Inv,4,4,2);
+	TSoAA.FromBatch(&TBatchA[0][0]);
+	TSoAB.FromBatch(&TBatchB[0][0]);
+	cout<<"Singular Matrices in Batch Inverse: "<<BatchInv(&TBatchInv[0][0],&TBatchA[0][0],3,3);
+	cout<<"\tin SoA Inverse: "<<TSoAInv.Inv(TSoAA)<<"\tin SoA Solve: "<<TSoAX.Solve(TSoAA,TSoAB)<<endl;
+	BatchDet(TBatchDet,&TBatchA[0][0],3,3);
+	TSoAA.Det(TSoADet);
+	for(ii=0;ii<3;ii++)
+	{
+		cout<<"Matrix "<<ii+1<<" Det of Batch: "<<TBatchDet[ii]<<"\tof SoA: "<<TSoADet[ii];
+		cout<<"\tInverse Difference: "<<Norm(BatchAt(&TBatchInv[0][0],3,3,ii)-TSoAInv.Get(ii));
+		cout<<"\tSolution:"<<endl;
+		(~TSoAX.Get(ii)).Print();
+	}
+	TSoA4.FromBatch(&TBatch4[0][0]);
+	cout<<"Singular 4x4 Matrices in SoA Inverse: "<<TSoA4Inv.Inv(TSoA4)<<endl;
+	for(ii=0;ii<2;ii++)
+	{
+		cout<<"4x4 Matrix "<<ii+1<<" Difference to Inverse of Mat: "<<Norm(TSoA4Inv.Get(ii)-(!BatchAt(&TBatch4[0][0],4,4,ii)))<<endl;
+	}
+	cout<<endl<<">>End"<<endl<<endl;
+
+	//Example 31: Structure of Arrays Multiply, Gemm, Cross, Point and Norm (Checked against Mat)
+	cout<<">>Example 31:"<<endl<<endl;
+	double TSoAVecL[20][3],TSoAVecR[20][3];
+	double TSoAPoint[20],TSoANorm[20];
+	for(ii=0;ii<20;ii++)
+	{
+		for(jj=0;jj<3;jj++)
+		{
+			TSoAVecL[ii][jj]=(double) (ii+jj+1);
+			TSoAVecR[ii][jj]=(double) (ii*jj%5)-2;
+		}
+	}
+	DefSoA(double,TSoAL,3,3,3);
+	DefSoA(double,TSoAOut,3,3,3);
+	DefSoA(double,TSoACrossL,3,1,20);
+	DefSoA(double,TSoACrossR,3,1,20);
+	TmpSoA(double,TSoACrossOut,3,1,20);
+	TSoAL.FromBatch(&TBatchA[0][0]);
+	TSoAOut.Mult(TSoAL,TSoAL);
+	for(ii=0;ii<3;ii++)
+	{
+		cout<<"Matrix "<<ii+1<<" Difference of SoA Multiply: "<<Norm(TSoAOut.Get(ii)-BatchAt(&TBatchA[0][0],3,3,ii)*BatchAt(&TBatchA[0][0],3,3,ii))<<endl;
+	}
+	TSoAOut.Gemm(2,TSoAL,TSoAL,-1);
+	cout<<"Gemm 2*A*A-A*A Difference to A*A: "<<Norm(TSoAOut.Get(1)-BatchAt(&TBatchA[0][0],3,3,1)*BatchAt(&TBatchA[0][0],3,3,1));
+	cout<<"\tLanes of "<<TSoAOut.Nm()<<" Matrices are "<<TSoAOut.St()<<" Apart"<<endl;
+	TSoACrossL.FromBatch(&TSoAVecL[0][0]);
+	TSoACrossR.FromBatch(&TSoAVecR[0][0]);
+	TSoACrossOut.Cross(TSoACrossL,TSoACrossR);
+	TSoACrossL.Point(TSoACrossR,TSoAPoint);
+	TSoACrossL.Norm(TSoANorm);
+	for(ii=0;ii<20;ii+=7)
+	{
+		cout<<"Vector "<<ii+1<<" Difference of SoA Cross: "<<Norm(TSoACrossOut.Get(ii)-Cross(TSoACrossL.Get(ii),TSoACrossR.Get(ii)));
+		cout<<"\tPoint: "<<TSoAPoint[ii]<<" (Mat "<<Point(TSoACrossL.Get(ii),TSoACrossR.Get(ii))<<")";
+		cout<<"\tNorm: "<<TSoANorm[ii]<<" (Mat "<<Norm(TSoACrossL.Get(ii))<<")"<<endl;
+	}
+	TSoACrossOut.CleanTmp();
+	cout<<endl<<">>End"<<endl<<endl;
 }
@@ -8,6 +8,130 @@
 
 #include "MiniMat.hpp"
 
+#if _HEAPSCOPE&&_MATPROFILE&&!_MICROCHIP
+	#include <time.h>
+
+	//Steady Clock in Microseconds (Default Clock Source of the Profiler)
+	u32 _Mat_DefaultClock()
+	{
+		timespec Now;
+		clock_gettime(CLOCK_MONOTONIC,&Now);
+		return ((u32) Now.tv_sec)*1000000UL+((u32) Now.tv_nsec)/1000UL;
+	}
+
+	#if _MATTIMELINE
+	//Steady Clock in Nanoseconds (Timeline Events, Independent of SetClock)
+	u64 _Mat_TraceClock()
+	{
+		timespec Now;
+		clock_gettime(CLOCK_MONOTONIC,&Now);
+		return ((u64) Now.tv_sec)*1000000000ULL+((u64) Now.tv_nsec);
+	}
+	#endif
+#endif
+
+#if _HEAPSCOPE&&_MATPROFILE&&_MATTIMELINE&&!_MICROCHIP
+	#include <fstream>
+
+	__thread _Mat_TraceBuf *_Mat_TraceLocal=NULL;
+	__thread u32 _Mat_TraceAllocNum=0;
+	__thread u32 _Mat_TraceAllocByte=0;
+	static _Mat_TraceBuf *_Mat_TraceHead=NULL;//List of Buffers of All Threads (Newest First)
+	static u32 _Mat_TraceThreads=0;//Number of Threads Registered
+
+	//Create the Buffer of the Calling Thread and Push it to the List without Lock (Buffers Outlive their Threads for Dumping)
+	_Mat_TraceBuf *_Mat_TraceOpen()
+	{
+		_Mat_TraceBuf *Buf=(_Mat_TraceBuf *) malloc(sizeof(_Mat_TraceBuf));
+		Buf->_Num=0;
+		Buf->_Lost=0;
+		Buf->_Tid=__sync_fetch_and_add(&_Mat_TraceThreads,1)+1;
+		_Mat_TraceBuf *Head=__atomic_load_n(&_Mat_TraceHead,__ATOMIC_RELAXED);
+		do
+		{
+			Buf->_Next=Head;
+		}
+		while(!__atomic_compare_exchange_n(&_Mat_TraceHead,&Head,Buf,true,__ATOMIC_RELEASE,__ATOMIC_RELAXED));
+		_Mat_TraceLocal=Buf;
+		return Buf;
+	}
+
+	//Drop Recorded Events of All Threads (Call when Workers are Idle)
+	void MiniMat_TraceClear()
+	{
+		_Mat_TraceBuf *Buf;
+		for(Buf=__atomic_load_n(&_Mat_TraceHead,__ATOMIC_ACQUIRE);Buf!=NULL;Buf=Buf->_Next)
+		{
+			__atomic_store_n(&(Buf->_Num),0,__ATOMIC_RELEASE);
+			Buf->_Lost=0;
+		}
+	}
+
+	//Write Events of All Threads as Chrome Trace JSON (Complete "X" Events, Times in Microseconds with Nanosecond Digits)
+	void MiniMat_TraceDump(ostream &Out)
+	{
+		_Mat_TraceBuf *Buf;
+		_Mat_TraceEvent *Event;
+		u32 ii,Num;
+		bool First=true;
+		ios::fmtflags Flags=Out.flags();
+		char Fill=Out.fill('0');
+
+		Out.setf(ios::dec,ios::basefield);
+		Out<<"{\"displayTimeUnit\":\"ns\",\"traceEvents\":["<<endl;
+		for(Buf=__atomic_load_n(&_Mat_TraceHead,__ATOMIC_ACQUIRE);Buf!=NULL;Buf=Buf->_Next)
+		{
+			Num=__atomic_load_n(&(Buf->_Num),__ATOMIC_ACQUIRE);
+			Out<<(First?"":",\n");
+			First=false;
+			Out<<"{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"<<Buf->_Tid;
+			Out<<",\"args\":{\"name\":\"MiniMat Thread "<<Buf->_Tid<<"\",\"lost\":"<<Buf->_Lost<<"}}";
+			Event=Buf->_Event;
+			for(ii=0;ii<Num;ii++)
+			{
+				Out<<",\n{\"name\":\""<<_Mat_Heap::OpName(Event->Id)<<"\",\"cat\":\"MiniMat\",\"ph\":\"X\",\"pid\":1,\"tid\":"<<Buf->_Tid;
+				Out<<",\"ts\":"<<(Event->Start/1000ULL)<<".";
+				Out.width(3);
+				Out<<(Event->Start%1000ULL)<<",\"dur\":"<<(Event->Dur/1000ULL)<<".";
+				Out.width(3);
+				Out<<(Event->Dur%1000ULL);
+				Out<<",\"args\":{\"allocs\":"<<Event->Allocs<<",\"bytes\":"<<Event->Bytes<<"}}";
+				Event++;
+			}
+		}
+		Out<<endl<<"]}"<<endl;
+		Out.flags(Flags);
+		Out.fill(Fill);
+	}
+
+	//Write Chrome Trace JSON to a File (False if it Cannot be Opened)
+	bool MiniMat_TraceDump(const char *FileName)
+	{
+		ofstream File(FileName);
+		if(!File)
+		{
+			return false;
+		}
+		MiniMat_TraceDump(File);
+		return true;
+	}
+#endif
+
+#if _MATARENA
+	__thread MiniMat_Arena *_Mat_ArenaLocal=NULL;
+#endif
+
 #if _HEAPSCOPE
+	#if _HEAPATOMIC
+		__thread MiniMat_HeapTrack *_Mat_Heap::_Track=NULL;
+		#if _HEAPTRACE
+			__thread const char *_Mat_Heap::_SiteFile=NULL;
+			__thread u16 _Mat_Heap::_SiteLine=0;
+		#endif
+		#if _MATPROFILE
+			__thread u8 _Mat_Heap::_CurrentOp=_PROF_NUM;
+		#endif
+	#endif
+
 	_Mat_Heap MiniMat_HeapScope;
 #endif
@@ -21,6 +21,24 @@
 *The feedback of matrix relies on Heap Memory Allocations.
 *All of the "friend" and "operator overloading" functions will destroy the input object if is temporary.
 *MiniMat_HeapScope can be used to monitor heap status when activated.
+*With _MATPROFILE (needs _HEAPSCOPE), MiniMat_HeapScope also counts calls, allocations, bytes, flops and time per operation;
+*	read them with MiniMat_HeapScope.Op(_PROF_MULT) etc. or Print(), and set the clock with SetClock (e.g. a cycle counter on MCU).
+*A MiniMat_HeapTrack object declared in a scope measures the heap from its creation: peak, net and allocated bytes/temps (nests).
+*With _HEAPTRACE (needs _HEAPSCOPE), every live TmpMat/RetMat keeps the file and line that created it,
+*	MiniMat_HeapScope.LeakReport() lists the live ones grouped by call site, and is called at exit if any is left.
+*	Results of operators and friend functions are created inside MiniMat.hpp, so they are reported at lines of this file;
+*	write "MatSite;" in a block (once per block) to report every temp allocated until the block ends at that line instead.
+*With _MATTIMELINE (needs _MATPROFILE, not on _MICROCHIP), each profiled operation is also kept as an event in a buffer of its thread,
+*	events count only the heap allocated by their own thread, and MiniMat_TraceDump("trace.json") writes them as Chrome trace JSON
+*	for chrome://tracing or Perfetto (dump when workers are idle). Events are timed by their own 64 bits nanosecond steady clock,
+*	not by SetClock, so they keep sub-microsecond durations and do not wrap.
+*With _HEAPATOMIC (GCC or Clang), the counters of MiniMat_HeapScope are updated with relaxed atomics so several threads can share them,
+*	and trackers and the running profiled operation become per thread (trackers still see the heap of all threads, so a tracker
+*	budgets one task only when no other thread allocates meanwhile; use a per thread MiniMat_Arena to bound one task).
+*With _MATARENA (GCC or Clang), a MiniMat_Arena object declared in a scope serves TmpMat/RetMat of its own thread from one buffer:
+*	allocation is a pointer bump, freeing the newest block or the last live block rewinds it, Reset() clears Peak() for the next task once all temps are cleaned,
+*	and requests that do not fit fall back to malloc. Temps must be cleaned on their thread before the arena ends (arenas nest).
+*	Heap counters still see every temp, use _HEAPATOMIC as well when several threads run.
 *If defined for _MICROCHIP, iostream and some type definitions will be disabled;
 *DO NOT ATTEMPT RISKY OPERATIONS SINCE THEY MAY CAUSE UNEXPECTED ERRORs!!!
 *For examples, please check Main.cpp.
@@ -37,8 +55,42 @@
 	#define _HEAPSCOPE 1
 #endif
 
+#ifndef _MATPROFILE
+	#define _MATPROFILE 0
+#endif
+
+#ifndef _HEAPTRACE
+	#define _HEAPTRACE 0
+#endif
+
+#ifndef _MATTIMELINE
+	#define _MATTIMELINE 0
+#endif
+
+#ifndef _HEAPATOMIC
+	#define _HEAPATOMIC 0
+#endif
+
+#ifndef _MATARENA
+	#define _MATARENA 0
+#endif
+
+#ifndef _MATARENA_ALIGN
+	#define _MATARENA_ALIGN 16//Alignment of Arena Blocks (Power of 2)
+#endif
+
+#ifndef _MATTIMELINE_MAX
+	#define _MATTIMELINE_MAX 4096//Maximum Number of Events Kept per Thread
+#endif
+
+#ifndef _HEAPTRACE_MAX
+	#define _HEAPTRACE_MAX 256//Maximum Number of Live Traced Mats
+#endif
+
 #include <stdlib.h>
+#include <string.h>
 #include <cmath>
+#include <limits>
 
 #if !_MICROCHIP
 	#include <iostream>
@@ -48,11 +100,227 @@
 	typedef signed char s8;
 	typedef signed short s16;
 	typedef signed long s32;
+	typedef unsigned long long u64;
+	typedef signed long long s64;
 #endif
 
 using namespace std;
 
+//Exact 32 Bits Word for Float Bit Operations (u32 is unsigned long, which is 64 Bits on LP64 Systems)
+template <bool IsInt>
+
+class _Mat_Word
+{
+public:
+	typedef unsigned long Type;
+};
+
+template <>
+
+class _Mat_Word<true>
+{
+public:
+	typedef unsigned int Type;
+};
+
+typedef _Mat_Word<sizeof(unsigned int)==4>::Type _Mat_Bits32;
+
+#if _HEAPSCOPE&&_MATPROFILE
+	//Profiled Operations
+	enum
+	{
+		_PROF_MULT,//Matrix Multiply
+		_PROF_PLUS,//Matrix Plus
+		_PROF_MINUS,//Matrix Minus
+		_PROF_SCALAR,//Interaction with Single Values
+		_PROF_TRANS,//Transpose
+		_PROF_DET,//Determinant
+		_PROF_INV,//Inverse
+		_PROF_SUB,//SubMatrix
+		_PROF_POINT,//Point Product
+		_PROF_CROSS,//Cross Product
+		_PROF_REDUCE,//Max, Min, Sum and Norm
+		_PROF_COMPARE,//Comparisons
+		_PROF_NUM
+	};
+
+	//Counters of One Operation (Allocations and Ticks Include Nested Operations)
+	class _Mat_OpStat
+	{
+	public:
+		u32 Calls;//Number of Calls
+		u32 Allocs;//Heap Allocations during Calls
+		u64 Bytes;//Bytes Read and Written (Nominal, Elements of Inputs and Output)
+		u64 Flops;//Arithmetic Operations (Nominal, 0 for Det, Inv and Sub)
+		u64 Ticks;//Cumulative Time in Clock Ticks
+	};
+
+	#if !_MICROCHIP
+		u32 _Mat_DefaultClock();//Steady Clock in Microseconds (Defined in MiniMat.cpp)
+	#endif
+	#if _MATTIMELINE&&!_MICROCHIP
+		u64 _Mat_TraceClock();//Steady Clock in Nanoseconds for Timeline Events (Defined in MiniMat.cpp)
+	#endif
+#endif
+
+#if _HEAPSCOPE&&_MATPROFILE&&_MATTIMELINE&&!_MICROCHIP
+	//One Finished Operation on the Timeline
+	class _Mat_TraceEvent
+	{
+	public:
+		u8 Id;//Operation
+		u64 Start;//Nanoseconds at Begin
+		u64 Dur;//Duration in Nanoseconds
+		u32 Allocs;//Heap Allocations of the Calling Thread during the Call
+		u32 Bytes;//Heap Bytes Allocated by the Calling Thread during the Call
+	};
+
+	//Event Buffer of One Thread (Only the Owner Thread Writes, so No Lock is Needed)
+	class _Mat_TraceBuf
+	{
+	public:
+		_Mat_TraceEvent _Event[_MATTIMELINE_MAX];
+		u32 _Num;//Events Recorded (Published with Release Store)
+		u32 _Lost;//Events Dropped since the Buffer was Full
+		u32 _Tid;//Thread Number in Order of First Event
+		_Mat_TraceBuf *_Next;//Next Buffer in the Global List
+	};
+
+	extern __thread _Mat_TraceBuf *_Mat_TraceLocal;//Buffer of the Calling Thread (NULL before its First Event)
+	extern __thread u32 _Mat_TraceAllocNum;//Cumulative Heap Allocations of the Calling Thread (Wraps Around)
+	extern __thread u32 _Mat_TraceAllocByte;//Cumulative Heap Bytes Allocated by the Calling Thread (Wraps Around)
+	_Mat_TraceBuf *_Mat_TraceOpen();//Create and Register the Buffer of the Calling Thread (Defined in MiniMat.cpp)
+
+	//Record a Finished Operation of the Calling Thread
+	inline void _Mat_TraceAdd(u8 Id, u64 Start, u64 Dur, u32 Allocs, u32 Bytes)
+	{
+		_Mat_TraceBuf *Buf=_Mat_TraceLocal;
+		_Mat_TraceEvent *Event;
+		if(Buf==NULL)
+		{
+			Buf=_Mat_TraceOpen();
+		}
+		if(Buf->_Num>=_MATTIMELINE_MAX)
+		{
+			Buf->_Lost++;
+			return;
+		}
+		Event=Buf->_Event+Buf->_Num;
+		Event->Id=Id;
+		Event->Start=Start;
+		Event->Dur=Dur;
+		Event->Allocs=Allocs;
+		Event->Bytes=Bytes;
+		__atomic_store_n(&(Buf->_Num),Buf->_Num+1,__ATOMIC_RELEASE);
+	}
+
+	void MiniMat_TraceClear();//Drop Recorded Events of All Threads (Call when Workers are Idle)
+	void MiniMat_TraceDump(ostream &Out);//Write Events of All Threads as Chrome Trace JSON
+	bool MiniMat_TraceDump(const char *FileName);//Write Chrome Trace JSON to a File (False if it Cannot be Opened)
+#endif
+
 #if _HEAPSCOPE
+	//Add to a Heap Counter and Return the New Value (Relaxed Atomic with _HEAPATOMIC)
+	inline u32 _Mat_CountAdd(u32 &Count, u32 Num)
+	{
+	#if _HEAPATOMIC
+		return __atomic_add_fetch(&Count,Num,__ATOMIC_RELAXED);
+	#else
+		Count+=Num;
+		return Count;
+	#endif
+	}
+
+	//Add to a 64 Bits Cumulative Counter (Operation Bytes, Flops and Ticks)
+	inline void _Mat_CountAdd(u64 &Count, u32 Num)
+	{
+	#if _HEAPATOMIC
+		__atomic_add_fetch(&Count,(u64) Num,__ATOMIC_RELAXED);
+	#else
+		Count+=Num;
+	#endif
+	}
+
+	//Subtract from a Heap Counter
+	inline void _Mat_CountSub(u32 &Count, u32 Num)
+	{
+	#if _HEAPATOMIC
+		__atomic_sub_fetch(&Count,Num,__ATOMIC_RELAXED);
+	#else
+		Count-=Num;
+	#endif
+	}
+
+	//Read a Heap Counter
+	inline u32 _Mat_CountGet(const u32 &Count)
+	{
+	#if _HEAPATOMIC
+		return __atomic_load_n(&Count,__ATOMIC_RELAXED);
+	#else
+		return Count;
+	#endif
+	}
+
+	//Raise a Peak Counter to a Value (Loops only while Another Thread Raises it Concurrently)
+	inline void _Mat_CountMax(u32 &Count, u32 Num)
+	{
+	#if _HEAPATOMIC
+		u32 Old=__atomic_load_n(&Count,__ATOMIC_RELAXED);
+		while((Num>Old)&&(!__atomic_compare_exchange_n(&Count,&Old,Num,true,__ATOMIC_RELAXED,__ATOMIC_RELAXED)))
+		{
+		}
+	#else
+		Count=((Num>Count)?Num:Count);
+	#endif
+	}
+
+	//Heap Tracking of a Scope (Declare as Local Variable, Inner Scopes Nest, Reports are Deltas from Creation)
+	//Heap usage is the shared count of MiniMat_HeapScope, so with _HEAPATOMIC it includes Mats of other threads
+	//	(budget one task per thread with the arena instead); peaks of live inner trackers are only seen on the creating thread.
+	class MiniMat_HeapTrack
+	{
+	public:
+		MiniMat_HeapTrack *_Parent;//Enclosing Tracker (NULL for Outermost)
+		u32 _StartByte;//Heap Usage at Creation
+		u32 _StartTempNum;//Temp Mat Usage at Creation
+		u32 _StartTotalByte;//Cumulative Allocated Bytes at Creation
+		u32 _StartTotalNum;//Cumulative Allocations at Creation
+		u32 _PeakByte;//Peak Heap Usage inside the Scope (Absolute)
+		u32 _PeakTempNum;//Peak Temp Mat Usage inside the Scope (Absolute)
+
+	public:
+		explicit MiniMat_HeapTrack();
+		~MiniMat_HeapTrack();
+
+		//Peak Heap Bytes above the Usage at Creation (Including Live Inner Trackers of the Same Thread)
+		u32 PeakByte() const;
+
+		//Peak Temp Mats above the Usage at Creation (Including Live Inner Trackers of the Same Thread)
+		u32 PeakTempNum() const;
+
+		//Net Heap Bytes Created and Not Freed Yet (Negative if Earlier Mats were Freed)
+		s32 NetByte() const;
+
+		//Net Temp Mats Created and Not Freed Yet
+		s32 NetTempNum() const;
+
+		//Bytes Allocated inside the Scope
+		u32 AllocByte() const;
+
+		//Allocations inside the Scope
+		u32 AllocNum() const;
+
+		//Check Peak against a Budget
+		bool Within(u32 BudgetByte) const
+		{
+			return PeakByte()<=BudgetByte;
+		}
+
+		#if !_MICROCHIP
+		void Print(const char *Name) const;
+		#endif
+	};
+
 	class _Mat_Heap
 	{
 	public:
@@ -60,48 +328,606 @@ using namespace std;
 		u32 _MaxByte;//Peak of Heap Usage
 		u32 _CurrentTempNum;//Current Temporary Matrix Usage
 		u32 _MaxTempNum;//Peak of Temporary Matrix Usage
+		u32 _TotalByte;//Cumulative Heap Allocated (Bytes, Wraps Around)
+		u32 _TotalTempNum;//Cumulative Temporary Matrix Allocations (malloc Calls)
+		#if _HEAPATOMIC
+		static __thread MiniMat_HeapTrack *_Track;//Innermost Active Scope Tracker of the Calling Thread
+		#else
+		MiniMat_HeapTrack *_Track;//Innermost Active Scope Tracker
+		#endif
+		#if _HEAPTRACE
+		void *_TracePtr[_HEAPTRACE_MAX];//Storage of Live Mats
+		const char *_TraceFile[_HEAPTRACE_MAX];//File of Allocation
+		u16 _TraceLine[_HEAPTRACE_MAX];//Line of Allocation
+		u32 _TraceByte[_HEAPTRACE_MAX];//Bytes of Allocation
+		u16 _TraceNum;//Number of Live Traced Mats
+		u32 _TraceLost;//Allocations not Traced since the Table was Full
+		#if _HEAPATOMIC
+		static __thread const char *_SiteFile;//File of the Innermost MatSite of the Calling Thread (NULL for None)
+		static __thread u16 _SiteLine;//Line of the Innermost MatSite of the Calling Thread
+		#else
+		const char *_SiteFile;//File of the Innermost MatSite (NULL for None)
+		u16 _SiteLine;//Line of the Innermost MatSite
+		#endif
+		#if _HEAPATOMIC
+		int _TraceLock;//Spin Lock of the Table
+		#endif
+		#endif
+		#if _MATPROFILE
+		_Mat_OpStat _Op[_PROF_NUM];//Counters per Operation
+		#if _HEAPATOMIC
+		static __thread u8 _CurrentOp;//Operation Running Now in the Calling Thread (_PROF_NUM for None)
+		#else
+		u8 _CurrentOp;//Operation Running Now (_PROF_NUM for None)
+		#endif
+		u32 (*_Clock)();//Clock Source (NULL Disables Timing)
+		u32 _TickRate;//Clock Ticks per Second
+		#endif
 
 	public:
 		explicit _Mat_Heap():
-		_CurrentByte(0),_MaxByte(0),_CurrentTempNum(0),_MaxTempNum(0)
-		{};
-		~_Mat_Heap(){};
+		_CurrentByte(0),_MaxByte(0),_CurrentTempNum(0),_MaxTempNum(0),_TotalByte(0),_TotalTempNum(0)
+		{
+			_Track=NULL;
+			#if _HEAPTRACE
+			_TraceNum=0;
+			_TraceLost=0;
+			_SiteFile=NULL;
+			_SiteLine=0;
+			#if _HEAPATOMIC
+			_TraceLock=0;
+			#endif
+			#endif
+			#if _MATPROFILE
+			_CurrentOp=_PROF_NUM;
+			#if _MICROCHIP
+			SetClock(NULL,1);
+			#else
+			SetClock(_Mat_DefaultClock,1000000);
+			#endif
+			ResetOps();
+			#endif
+		};
+		~_Mat_Heap()
+		{
+			#if _HEAPTRACE&&!_MICROCHIP
+			if(_TraceNum>0)
+			{
+				LeakReport();
+			}
+			#endif
+		};
+
+		_Mat_Heap &_HeapPlus(u32 plusnum)
+		{
+			u32 TempNum,Byte;
+			TempNum=_Mat_CountAdd(_CurrentTempNum,1);
+			_Mat_CountMax(_MaxTempNum,TempNum);
+			_Mat_CountAdd(_TotalTempNum,1);
+			_Mat_CountAdd(_TotalByte,plusnum);
+			#if _MATPROFILE
+			if(_CurrentOp<_PROF_NUM)
+			{
+				_Mat_CountAdd(_Op[_CurrentOp].Allocs,1);
+			}
+			#if _MATTIMELINE&&!_MICROCHIP
+			_Mat_TraceAllocNum++;
+			_Mat_TraceAllocByte+=plusnum;
+			#endif
+			#endif
+
+			Byte=_Mat_CountAdd(_CurrentByte,plusnum);
+			_Mat_CountMax(_MaxByte,Byte);
+			//Only the Innermost Tracker is Updated, its Peak Goes to the Parent when it Ends
+			if(_Track!=NULL)
+			{
+				_Track->_PeakByte=((Byte>_Track->_PeakByte)?Byte:_Track->_PeakByte);
+				_Track->_PeakTempNum=((TempNum>_Track->_PeakTempNum)?TempNum:_Track->_PeakTempNum);
+			}
 
-		_Mat_Heap _HeapPlus(u32 plusnum)
-		{
-			_CurrentTempNum++;
-			_MaxTempNum=((_CurrentTempNum>_MaxTempNum)?_CurrentTempNum:_MaxTempNum);
+			return *this;
+		}
 
-			_CurrentByte+=plusnum;
-			_MaxByte=((_CurrentByte>_MaxByte)?_CurrentByte:_MaxByte);
+		_Mat_Heap &_HeapMinus(u32 minusnum)
+		{
+			_Mat_CountSub(_CurrentTempNum,1);
+			_Mat_CountSub(_CurrentByte,minusnum);
 
 			return *this;
 		}
 
-		_Mat_Heap _HeapMinus(u32 minusnum)
+		#if _HEAPTRACE
+		//Record the Call Site of an Allocation (The Innermost MatSite Replaces it when Set)
+		void _HeapTrace(void *Ptr, u32 Byte, const char *File, u16 Line)
+		{
+			if(_SiteFile!=NULL)
+			{
+				File=_SiteFile;
+				Line=_SiteLine;
+			}
+			_TraceEnter();
+			if(_TraceNum>=_HEAPTRACE_MAX)
+			{
+				_TraceLost++;
+				_TraceLeave();
+				return;
+			}
+			_TracePtr[_TraceNum]=Ptr;
+			_TraceFile[_TraceNum]=File;
+			_TraceLine[_TraceNum]=Line;
+			_TraceByte[_TraceNum]=Byte;
+			_TraceNum++;
+			_TraceLeave();
+		}
+
+		//Forget an Allocation when Freed (Searched from the Newest, since Temps Usually Die First)
+		void _HeapUntrace(void *Ptr)
 		{
-			_CurrentTempNum--;
-			_CurrentByte-=minusnum;
+			u16 ii;
+			_TraceEnter();
+			for(ii=_TraceNum;ii>0;ii--)
+			{
+				if(_TracePtr[ii-1]==Ptr)
+				{
+					_TraceNum--;
+					_TracePtr[ii-1]=_TracePtr[_TraceNum];
+					_TraceFile[ii-1]=_TraceFile[_TraceNum];
+					_TraceLine[ii-1]=_TraceLine[_TraceNum];
+					_TraceByte[ii-1]=_TraceByte[_TraceNum];
+					break;
+				}
+			}
+			_TraceLeave();
+		}
 
-			return *this;
+		//Lock the Table (Only with _HEAPATOMIC, Tracing is a Debug Mode so a Spin Lock is Enough)
+		void _TraceEnter()
+		{
+			#if _HEAPATOMIC
+			while(__sync_lock_test_and_set(&_TraceLock,1))
+			{
+			}
+			#endif
+		}
+
+		//Unlock the Table
+		void _TraceLeave()
+		{
+			#if _HEAPATOMIC
+			__sync_lock_release(&_TraceLock);
+			#endif
+		}
+
+		//Number of Live Traced Mats
+		u16 LeakNum() const
+		{
+			return _TraceNum;
+		}
+
+		#if !_MICROCHIP
+		//List Live Mats Grouped by Call Site (Count and Bytes per File and Line)
+		void LeakReport() const
+		{
+			u16 ii,jj;
+			u32 Count,Byte;
+
+			cout<<endl;
+			cout<<"Heap Leak Report: "<<_TraceNum<<" Live Temp Mats"<<endl;
+			for(ii=0;ii<_TraceNum;ii++)
+			{
+				for(jj=0;jj<ii;jj++)
+				{
+					if((_TraceLine[jj]==_TraceLine[ii])&&(strcmp(_TraceFile[jj],_TraceFile[ii])==0))
+					{
+						break;
+					}
+				}
+				if(jj<ii)
+				{
+					continue;
+				}
+				Count=0;
+				Byte=0;
+				for(jj=ii;jj<_TraceNum;jj++)
+				{
+					if((_TraceLine[jj]==_TraceLine[ii])&&(strcmp(_TraceFile[jj],_TraceFile[ii])==0))
+					{
+						Count++;
+						Byte+=_TraceByte[jj];
+					}
+				}
+				cout<<_TraceFile[ii]<<":"<<_TraceLine[ii]<<"\t"<<Count<<" Mats\t"<<Byte<<" Bytes"<<endl;
+			}
+			if(_TraceLost>0)
+			{
+				cout<<_TraceLost<<" Allocations were not Traced (Raise _HEAPTRACE_MAX)"<<endl;
+			}
+			cout<<"End of Heap Leak Report"<<endl<<endl;
+			return;
+		}
+		#endif
+		#endif
+
+		#if _MATPROFILE
+		//Set Clock Source (Ticks Counting Up, Wrapping is Fine) and its Ticks per Second
+		void SetClock(u32 (*Clock)(), u32 TickRate)
+		{
+			_Clock=Clock;
+			_TickRate=TickRate;
+		}
+
+		//Clear Counters of All Operations
+		void ResetOps()
+		{
+			u8 ii;
+			for(ii=0;ii<_PROF_NUM;ii++)
+			{
+				_Op[ii].Calls=0;
+				_Op[ii].Allocs=0;
+				_Op[ii].Bytes=0;
+				_Op[ii].Flops=0;
+				_Op[ii].Ticks=0;
+			}
+		}
+
+		//Counters of an Operation
+		const _Mat_OpStat & Op(u8 Id) const
+		{
+			return _Op[Id];
 		}
 
+		//Name of an Operation
+		static const char * OpName(u8 Id)
+		{
+			static const char *Name[_PROF_NUM]={"Mult","Plus","Minus","Scalar","Trans","Det","Inv","Sub","Point","Cross","Reduce","Compare"};
+			return Name[Id];
+		}
+		#endif
+
 		#if !_MICROCHIP
 		void Print()
 		{
 			cout<<endl;
 			cout<<"Heap Memory Usage Report:"<<endl;
-			cout<<"Current Heap Usage: "<<_CurrentByte<<"\t";
-			cout<<"Maximum Heap Used: "<<_MaxByte<<"\t";
-			cout<<"Current Temp Mat Usage: "<<_CurrentTempNum<<"\t";
-			cout<<"Maximum Temp Mat Used: "<<_MaxTempNum<<"\t";
+			cout<<"Current Heap Usage: "<<_Mat_CountGet(_CurrentByte)<<"\t";
+			cout<<"Maximum Heap Used: "<<_Mat_CountGet(_MaxByte)<<"\t";
+			cout<<"Current Temp Mat Usage: "<<_Mat_CountGet(_CurrentTempNum)<<"\t";
+			cout<<"Maximum Temp Mat Used: "<<_Mat_CountGet(_MaxTempNum)<<"\t";
 			cout<<endl;
+			#if _MATPROFILE
+			u8 ii;
+			cout<<"Operation\tCalls\tAllocs\tBytes\tFlops\tTicks\t(Ticks per Second: "<<_TickRate<<")"<<endl;
+			for(ii=0;ii<_PROF_NUM;ii++)
+			{
+				if(_Op[ii].Calls>0)
+				{
+					cout<<OpName(ii)<<"\t\t"<<_Op[ii].Calls<<"\t"<<_Op[ii].Allocs<<"\t"<<_Op[ii].Bytes<<"\t"<<_Op[ii].Flops<<"\t"<<_Op[ii].Ticks<<endl;
+				}
+			}
+			#endif
 			cout<<"End of Heap Memory Usage Report"<<endl<<endl;
 			return;
 		}
 		#endif
 	};
 	extern _Mat_Heap MiniMat_HeapScope;
+
+	#if _HEAPTRACE
+	//Call Site of the Temps Allocated in a Scope (Declare with MatSite, Restores the Enclosing Site when it Ends)
+	class MiniMat_TraceSite
+	{
+	public:
+		const char *_PrevFile;//Enclosing Site File
+		u16 _PrevLine;//Enclosing Site Line
+
+	public:
+		explicit MiniMat_TraceSite(const char *File, u16 Line):
+		_PrevFile(MiniMat_HeapScope._SiteFile),_PrevLine(MiniMat_HeapScope._SiteLine)
+		{
+			MiniMat_HeapScope._SiteFile=File;
+			MiniMat_HeapScope._SiteLine=Line;
+		}
+
+		~MiniMat_TraceSite()
+		{
+			MiniMat_HeapScope._SiteFile=_PrevFile;
+			MiniMat_HeapScope._SiteLine=_PrevLine;
+		}
+	};
+	#endif
+
+	inline MiniMat_HeapTrack::MiniMat_HeapTrack():
+	_Parent(MiniMat_HeapScope._Track),
+	_StartByte(_Mat_CountGet(MiniMat_HeapScope._CurrentByte)),_StartTempNum(_Mat_CountGet(MiniMat_HeapScope._CurrentTempNum)),
+	_StartTotalByte(_Mat_CountGet(MiniMat_HeapScope._TotalByte)),_StartTotalNum(_Mat_CountGet(MiniMat_HeapScope._TotalTempNum)),
+	_PeakByte(_StartByte),_PeakTempNum(_StartTempNum)
+	{
+		MiniMat_HeapScope._Track=this;
+	}
+
+	inline MiniMat_HeapTrack::~MiniMat_HeapTrack()
+	{
+		if(_Parent!=NULL)
+		{
+			_Parent->_PeakByte=((_PeakByte>_Parent->_PeakByte)?_PeakByte:_Parent->_PeakByte);
+			_Parent->_PeakTempNum=((_PeakTempNum>_Parent->_PeakTempNum)?_PeakTempNum:_Parent->_PeakTempNum);
+		}
+		MiniMat_HeapScope._Track=_Parent;
+	}
+
+	inline u32 MiniMat_HeapTrack::PeakByte() const
+	{
+		//Inner Trackers Merge their Peaks only when they End, so Walk the Live Ones down to this Tracker
+		u32 Peak=_PeakByte;
+		MiniMat_HeapTrack *Inner=MiniMat_HeapScope._Track;
+		while((Inner!=NULL)&&(Inner!=this))
+		{
+			Peak=((Inner->_PeakByte>Peak)?Inner->_PeakByte:Peak);
+			Inner=Inner->_Parent;
+		}
+		return ((Inner==this)?Peak:_PeakByte)-_StartByte;
+	}
+
+	inline u32 MiniMat_HeapTrack::PeakTempNum() const
+	{
+		u32 Peak=_PeakTempNum;
+		MiniMat_HeapTrack *Inner=MiniMat_HeapScope._Track;
+		while((Inner!=NULL)&&(Inner!=this))
+		{
+			Peak=((Inner->_PeakTempNum>Peak)?Inner->_PeakTempNum:Peak);
+			Inner=Inner->_Parent;
+		}
+		return ((Inner==this)?Peak:_PeakTempNum)-_StartTempNum;
+	}
+
+	inline s32 MiniMat_HeapTrack::NetByte() const
+	{
+		return ((s32) _Mat_CountGet(MiniMat_HeapScope._CurrentByte))-((s32) _StartByte);
+	}
+
+	inline s32 MiniMat_HeapTrack::NetTempNum() const
+	{
+		return ((s32) _Mat_CountGet(MiniMat_HeapScope._CurrentTempNum))-((s32) _StartTempNum);
+	}
+
+	inline u32 MiniMat_HeapTrack::AllocByte() const
+	{
+		return _Mat_CountGet(MiniMat_HeapScope._TotalByte)-_StartTotalByte;
+	}
+
+	inline u32 MiniMat_HeapTrack::AllocNum() const
+	{
+		return _Mat_CountGet(MiniMat_HeapScope._TotalTempNum)-_StartTotalNum;
+	}
+
+	#if !_MICROCHIP
+	inline void MiniMat_HeapTrack::Print(const char *Name) const
+	{
+		cout<<endl;
+		cout<<"Heap Track of "<<Name<<":"<<endl;
+		cout<<"Peak Heap Used: "<<PeakByte()<<"\t";
+		cout<<"Peak Temp Mat Used: "<<PeakTempNum()<<"\t";
+		cout<<"Net Heap Change: "<<NetByte()<<"\t";
+		cout<<"Net Temp Mat Change: "<<NetTempNum()<<"\t";
+		cout<<"Allocated: "<<AllocByte()<<" Bytes in "<<AllocNum()<<" Temp Mats"<<endl;
+		return;
+	}
+	#endif
+#endif
+
+#if _HEAPSCOPE&&_MATPROFILE
+	//Profiler of One Operation Call (Counts when Created, Adds Time when Leaving the Scope)
+	class _Mat_ProfScope
+	{
+	public:
+		u8 _Id;
+		u8 _PrevOp;
+		u32 _Start;
+		#if _MATTIMELINE&&!_MICROCHIP
+		u64 _TraceStart;
+		u32 _StartAllocByte;
+		u32 _StartAllocNum;
+		#endif
+
+		explicit _Mat_ProfScope(u8 Id, u32 Bytes, u32 Flops):
+		_Id(Id),_PrevOp(MiniMat_HeapScope._CurrentOp),_Start(0)
+		{
+			#if _MATTIMELINE&&!_MICROCHIP
+			_StartAllocByte=_Mat_TraceAllocByte;
+			_StartAllocNum=_Mat_TraceAllocNum;
+			#endif
+			_Mat_CountAdd(MiniMat_HeapScope._Op[Id].Calls,1);
+			_Mat_CountAdd(MiniMat_HeapScope._Op[Id].Bytes,Bytes);
+			_Mat_CountAdd(MiniMat_HeapScope._Op[Id].Flops,Flops);
+			MiniMat_HeapScope._CurrentOp=Id;
+			if(MiniMat_HeapScope._Clock!=NULL)
+			{
+				_Start=MiniMat_HeapScope._Clock();
+			}
+			#if _MATTIMELINE&&!_MICROCHIP
+			_TraceStart=_Mat_TraceClock();
+			#endif
+		};
+
+		~_Mat_ProfScope()
+		{
+			#if _MATTIMELINE&&!_MICROCHIP
+			u64 TraceEnd=_Mat_TraceClock();
+			#endif
+			if(MiniMat_HeapScope._Clock!=NULL)
+			{
+				_Mat_CountAdd(MiniMat_HeapScope._Op[_Id].Ticks,MiniMat_HeapScope._Clock()-_Start);
+			}
+			#if _MATTIMELINE&&!_MICROCHIP
+			_Mat_TraceAdd(_Id,_TraceStart,TraceEnd-_TraceStart,_Mat_TraceAllocNum-_StartAllocNum,_Mat_TraceAllocByte-_StartAllocByte);
+			#endif
+			MiniMat_HeapScope._CurrentOp=_PrevOp;
+		};
+	};
+
+	#define MatProf(ID,BYTES,FLOPS) _Mat_ProfScope _ProfScope((ID),(u32) (BYTES),(u32) (FLOPS))
+#else
+	#define MatProf(ID,BYTES,FLOPS)
+#endif
+
+#if _MATARENA
+	//Bump Allocator for Temp Mats of One Thread (Declare as Local Variable, Active until it Ends, Inner Arenas Nest)
+	class MiniMat_Arena
+	{
+	public:
+		MiniMat_Arena *_Parent;//Enclosing Arena of the Thread (NULL for Outermost)
+		unsigned char *_Base;//Buffer
+		u32 _Cap;//Buffer Size (Bytes)
+		u32 _Used;//Bytes Handed Out (Rewinds on Free of the Newest Block or the Last Live Block)
+		u32 _Peak;//Peak of _Used
+		u32 _Live;//Blocks Not Freed Yet
+		u32 _Fallback;//Requests Sent to malloc since the Buffer was Full
+		bool _Own;//Buffer is Allocated by the Arena
+
+	public:
+		explicit MiniMat_Arena(u32 Byte);
+		explicit MiniMat_Arena(void *Buffer, u32 Byte);
+		~MiniMat_Arena();
+
+		//Take a Block (NULL if it does not Fit)
+		void *_Alloc(u32 Byte)
+		{
+			u32 Size=(Byte+_MATARENA_ALIGN-1)&(~((u32) (_MATARENA_ALIGN-1)));
+			void *Ptr;
+			if(Size>_Cap-_Used)
+			{
+				_Fallback++;
+				return NULL;
+			}
+			Ptr=_Base+_Used;
+			_Used+=Size;
+			_Peak=((_Used>_Peak)?_Used:_Peak);
+			_Live++;
+			return Ptr;
+		}
+
+		//Check if a Block is from this Arena
+		bool _Owns(void *Ptr) const
+		{
+			return (((unsigned char *) Ptr)>=_Base)&&(((unsigned char *) Ptr)<_Base+_Cap);
+		}
+
+		//Give Back a Block (Ignored if No Block is Live, e.g. Freed Twice)
+		void _Free(void *Ptr, u32 Byte)
+		{
+			u32 Size=(Byte+_MATARENA_ALIGN-1)&(~((u32) (_MATARENA_ALIGN-1)));
+			if(_Live==0)
+			{
+				return;
+			}
+			_Live--;
+			if(_Live==0)
+			{
+				_Used=0;
+			}
+			else if(((unsigned char *) Ptr)+Size==_Base+_Used)
+			{
+				_Used-=Size;
+			}
+		}
+
+		//Start a New Task: Rewind and Clear Peak and Fallback (Return 0 and Keep Everything if Temps are Still Live)
+		bool Reset()
+		{
+			if(_Live!=0)
+			{
+				return 0;
+			}
+			_Used=0;
+			_Peak=0;
+			_Fallback=0;
+			return 1;
+		}
+
+		u32 Used() const
+		{
+			return _Used;
+		}
+
+		u32 Peak() const
+		{
+			return _Peak;
+		}
+
+		u32 Live() const
+		{
+			return _Live;
+		}
+
+		u32 Fallback() const
+		{
+			return _Fallback;
+		}
+	};
+
+	extern __thread MiniMat_Arena *_Mat_ArenaLocal;//Innermost Active Arena of the Calling Thread
+
+	inline MiniMat_Arena::MiniMat_Arena(u32 Byte):
+	_Parent(_Mat_ArenaLocal),_Base((unsigned char *) malloc(Byte)),_Cap(Byte),_Used(0),_Peak(0),_Live(0),_Fallback(0),_Own(true)
+	{
+		if(_Base==NULL)
+		{
+			_Cap=0;
+		}
+		_Mat_ArenaLocal=this;
+	}
+
+	inline MiniMat_Arena::MiniMat_Arena(void *Buffer, u32 Byte):
+	_Parent(_Mat_ArenaLocal),_Base((unsigned char *) Buffer),_Cap(Byte),_Used(0),_Peak(0),_Live(0),_Fallback(0),_Own(false)
+	{
+		_Mat_ArenaLocal=this;
+	}
+
+	inline MiniMat_Arena::~MiniMat_Arena()
+	{
+		_Mat_ArenaLocal=_Parent;
+		if(_Own)
+		{
+			free(_Base);
+		}
+	}
+
+	//Allocate a Temp Mat Buffer from the Active Arena of the Thread, or from malloc
+	inline void *_Mat_Alloc(u32 Byte)
+	{
+		MiniMat_Arena *Arena=_Mat_ArenaLocal;
+		void *Ptr;
+		if(Arena!=NULL)
+		{
+			Ptr=Arena->_Alloc(Byte);
+			if(Ptr!=NULL)
+			{
+				return Ptr;
+			}
+		}
+		return malloc(Byte);
+	}
+
+	//Free a Temp Mat Buffer to the Arena it Came from, or to free
+	inline void _Mat_Free(void *Ptr, u32 Byte)
+	{
+		MiniMat_Arena *Arena;
+		for(Arena=_Mat_ArenaLocal;Arena!=NULL;Arena=Arena->_Parent)
+		{
+			if(Arena->_Owns(Ptr))
+			{
+				Arena->_Free(Ptr,Byte);
+				return;
+			}
+		}
+		free(Ptr);
+	}
+
+	#define MatAlloc(BYTE) _Mat_Alloc((u32) (BYTE))
+	#define MatFree(PTR,BYTE) _Mat_Free((void *) (PTR),(u32) (BYTE))
+#else
+	#define MatAlloc(BYTE) malloc(BYTE)
+	#define MatFree(PTR,BYTE) free(PTR)
 #endif
 
 
@@ -113,27 +939,38 @@ using namespace std;
 	TYPE MACON(NAME,DEFMAT)[((const u16) ROW)*((const u16) COL)];\
 	Mat<TYPE> NAME( (u8) ROW , (u8) COL , ((TYPE *) &(MACON(NAME,DEFMAT)[0])) );
 
+//Record the call site of a heap matrix
+#if _HEAPSCOPE&&_HEAPTRACE
+	#define MatTrace(PTR,BYTE) MiniMat_HeapScope._HeapTrace((void *) (PTR),(u32) (BYTE),__FILE__,(u16) __LINE__)
+	#define MatSite MiniMat_TraceSite _Mat_SiteScope(__FILE__,(u16) __LINE__)
+#else
+	#define MatTrace(PTR,BYTE)
+	#define MatSite
+#endif
+
 //Define a return matrix (temporary)
 #if _HEAPSCOPE
 	#define TmpMat(TYPE,NAME,ROW,COL) \
-			TYPE *MACON(NAME,TMPMAT)=(TYPE *) malloc(sizeof(TYPE)*((const u16) ROW)*((const u16) COL));\
+			TYPE *MACON(NAME,TMPMAT)=(TYPE *) MatAlloc(sizeof(TYPE)*((const u16) ROW)*((const u16) COL));\
 			MiniMat_HeapScope._HeapPlus((sizeof(TYPE)*((u32) ROW)*((u32) COL)));\
+			MatTrace(MACON(NAME,TMPMAT),sizeof(TYPE)*((u32) ROW)*((u32) COL));\
 			Mat<TYPE> NAME( (u8) ROW , (u8) COL , MACON(NAME,TMPMAT) );\
 			NAME.SetTemp();
 
 	#define RetMat(TYPE,NAME,ROW,COL) \
-			TYPE *MACON(NAME,RETMAT)=(TYPE *) malloc(sizeof(TYPE)*((const u16) ROW)*((const u16) COL));\
+			TYPE *MACON(NAME,RETMAT)=(TYPE *) MatAlloc(sizeof(TYPE)*((const u16) ROW)*((const u16) COL));\
 			MiniMat_HeapScope._HeapPlus((sizeof(TYPE)*((u32) ROW)*((u32) COL)));\
+			MatTrace(MACON(NAME,RETMAT),sizeof(TYPE)*((u32) ROW)*((u32) COL));\
 			Mat<TYPE> NAME( (u8) ROW , (u8) COL , MACON(NAME,RETMAT) );\
 			NAME.SetReturn();
 #else
 	#define TmpMat(TYPE,NAME,ROW,COL) \
-			TYPE *MACON(NAME,TMPMAT)=(TYPE *) malloc(sizeof(TYPE)*((const u16) ROW)*((const u16) COL));\
+			TYPE *MACON(NAME,TMPMAT)=(TYPE *) MatAlloc(sizeof(TYPE)*((const u16) ROW)*((const u16) COL));\
 			Mat<TYPE> NAME( (u8) ROW , (u8) COL , MACON(NAME,TMPMAT) );\
 			NAME.SetTemp();
 
 	#define RetMat(TYPE,NAME,ROW,COL) \
-			TYPE *MACON(NAME,RETMAT)=(TYPE *) malloc(sizeof(TYPE)*((const u16) ROW)*((const u16) COL));\
+			TYPE *MACON(NAME,RETMAT)=(TYPE *) MatAlloc(sizeof(TYPE)*((const u16) ROW)*((const u16) COL));\
 			Mat<TYPE> NAME( (u8) ROW , (u8) COL , MACON(NAME,RETMAT) );\
 			NAME.SetReturn();
 #endif
@@ -153,6 +990,43 @@ using namespace std;
 
 
 
+class BitMat;//Bit Packed Boolean Matrix (Defined in MiniMatBits.hpp)
+
+//Element Operations Used by Broadcast and Element-wise Kernels
+class _OpPlus{public: template <class Type> static Type Do(Type ValL, Type ValR){return ValL+ValR;}};
+class _OpMinus{public: template <class Type> static Type Do(Type ValL, Type ValR){return ValL-ValR;}};
+class _OpMult{public: template <class Type> static Type Do(Type ValL, Type ValR){return ValL*ValR;}};
+class _OpDiv{public: template <class Type> static Type Do(Type ValL, Type ValR){return ValL/ValR;}};
+
+//Accumulator of Multiply and Point Product (Specialized by Types Requiring Wide Accumulation, see MiniMatFixed.hpp)
+template <class Type>
+
+class MiniMat_Acc
+{
+public:
+	typedef Type Acc;//Accumulator Type
+
+	//Empty Accumulator
+	static Acc Zero()
+	{
+		return 0;
+	}
+
+	//Multiply and Accumulate
+	static void Mac(Acc &SumVal, Type ValL, Type ValR)
+	{
+		SumVal+=ValL*ValR;
+	}
+
+	//Accumulator Back to Element Type
+	static Type Out(Acc SumVal)
+	{
+		return SumVal;
+	}
+};
+
+
+
 template <class Type>
 
 class Mat
@@ -160,19 +1034,330 @@ class Mat
 
 protected://Variables (None of the variables can be directly accessed)
 
-	Type *_IPtr;//Input Operating Pointer
+	Type *_IPtr;//Input Operating Pointer
+
+	bool _IsVector;//Indicate Vector Stat
+	bool _IsSquare;//Indicate Square Stat
+	bool _IsSingle;//Indicate Single Value Stat
+
+	bool _IsTemp;//Indicate Temperorary Status
+	bool _IsReturn;//Indicate Global Variable Status
+
+	Type *_Value;//Root Pointer
+	u8 _Row;//Number of Rows
+	u8 _Col;//Number of Columns
+	u16 _Size;//Number of Elements
+
+
+
+protected://Reduction Kernels (Blocks are Row Runs of Num Elements Separated by Stride, Whole Matrix is One Run of _Size)
+
+	//Square Root Matching the Element Type
+	static float _Sqrt(float Value)
+	{
+		return sqrtf(Value);
+	}
+
+	//Square Root Matching the Element Type
+	static double _Sqrt(double Value)
+	{
+		return sqrt(Value);
+	}
+
+	//Square Root of Other Types (Through Float)
+	template <class Other>
+	static Other _Sqrt(Other Value)
+	{
+		return (Other) sqrtf((float) Value);
+	}
+
+	//Sum of a Run (4 Independent Lanes for SIMD/Pipelining)
+	static Type _SumRun(Type *Ptr, u16 Num)
+	{
+		Type Sum0=0,Sum1=0,Sum2=0,Sum3=0;
+		u16 ii;
+		for(ii=0;ii+4<=Num;ii+=4)
+		{
+			Sum0+=*(Ptr+ii);
+			Sum1+=*(Ptr+ii+1);
+			Sum2+=*(Ptr+ii+2);
+			Sum3+=*(Ptr+ii+3);
+		}
+		for(;ii<Num;ii++)
+		{
+			Sum0+=*(Ptr+ii);
+		}
+		return (Sum0+Sum1)+(Sum2+Sum3);
+	}
+
+	//Sum of Squares of a Run (4 Independent Lanes for SIMD/Pipelining)
+	static Type _SquareRun(Type *Ptr, u16 Num, Type Scale)
+	{
+		Type Sum0=0,Sum1=0,Sum2=0,Sum3=0;
+		Type Val0,Val1,Val2,Val3;
+		u16 ii;
+		for(ii=0;ii+4<=Num;ii+=4)
+		{
+			Val0=(*(Ptr+ii))*Scale;
+			Val1=(*(Ptr+ii+1))*Scale;
+			Val2=(*(Ptr+ii+2))*Scale;
+			Val3=(*(Ptr+ii+3))*Scale;
+			Sum0+=Val0*Val0;
+			Sum1+=Val1*Val1;
+			Sum2+=Val2*Val2;
+			Sum3+=Val3*Val3;
+		}
+		for(;ii<Num;ii++)
+		{
+			Val0=(*(Ptr+ii))*Scale;
+			Sum0+=Val0*Val0;
+		}
+		return (Sum0+Sum1)+(Sum2+Sum3);
+	}
+
+	//Maximum (Bigger=1) or Minimum (Bigger=0) of a Run without Branches (4 Independent Lanes)
+	static Type _ExtRun(Type *Ptr, u16 Num, bool Bigger)
+	{
+		Type Ext0=*Ptr,Ext1=*Ptr,Ext2=*Ptr,Ext3=*Ptr;
+		u16 ii;
+		if(Bigger)
+		{
+			for(ii=0;ii+4<=Num;ii+=4)
+			{
+				Ext0=(*(Ptr+ii)>Ext0)?*(Ptr+ii):Ext0;
+				Ext1=(*(Ptr+ii+1)>Ext1)?*(Ptr+ii+1):Ext1;
+				Ext2=(*(Ptr+ii+2)>Ext2)?*(Ptr+ii+2):Ext2;
+				Ext3=(*(Ptr+ii+3)>Ext3)?*(Ptr+ii+3):Ext3;
+			}
+			for(;ii<Num;ii++)
+			{
+				Ext0=(*(Ptr+ii)>Ext0)?*(Ptr+ii):Ext0;
+			}
+			Ext0=(Ext1>Ext0)?Ext1:Ext0;
+			Ext2=(Ext3>Ext2)?Ext3:Ext2;
+			return (Ext2>Ext0)?Ext2:Ext0;
+		}
+		for(ii=0;ii+4<=Num;ii+=4)
+		{
+			Ext0=(*(Ptr+ii)<Ext0)?*(Ptr+ii):Ext0;
+			Ext1=(*(Ptr+ii+1)<Ext1)?*(Ptr+ii+1):Ext1;
+			Ext2=(*(Ptr+ii+2)<Ext2)?*(Ptr+ii+2):Ext2;
+			Ext3=(*(Ptr+ii+3)<Ext3)?*(Ptr+ii+3):Ext3;
+		}
+		for(;ii<Num;ii++)
+		{
+			Ext0=(*(Ptr+ii)<Ext0)?*(Ptr+ii):Ext0;
+		}
+		Ext0=(Ext1<Ext0)?Ext1:Ext0;
+		Ext2=(Ext3<Ext2)?Ext3:Ext2;
+		return (Ext2<Ext0)?Ext2:Ext0;
+	}
+
+	//Maximum Magnitude of a Run
+	static Type _AbsMaxRun(Type *Ptr, u16 Num)
+	{
+		Type MaxVal=0;
+		Type AbsVal;
+		u16 ii;
+		for(ii=0;ii<Num;ii++)
+		{
+			AbsVal=(*(Ptr+ii)<0)?(-*(Ptr+ii)):(*(Ptr+ii));
+			MaxVal=(AbsVal>MaxVal)?AbsVal:MaxVal;
+		}
+		return MaxVal;
+	}
+
+	//Fused Minimum and Maximum of a Run with First Positions (2 Independent Lanes, Positions Start from 0)
+	static void _MinMaxRun(Type *Ptr, u16 Num, Type &MinVal, Type &MaxVal, u16 &ArgMin, u16 &ArgMax)
+	{
+		Type Min0=*Ptr,Min1=*Ptr,Max0=*Ptr,Max1=*Ptr;
+		u16 MinIdx0=0,MinIdx1=0,MaxIdx0=0,MaxIdx1=0;
+		bool Better;
+		u16 ii;
+		for(ii=0;ii+2<=Num;ii+=2)
+		{
+			Better=(*(Ptr+ii)<Min0);
+			Min0=Better?*(Ptr+ii):Min0;
+			MinIdx0=Better?ii:MinIdx0;
+			Better=(*(Ptr+ii)>Max0);
+			Max0=Better?*(Ptr+ii):Max0;
+			MaxIdx0=Better?ii:MaxIdx0;
+			Better=(*(Ptr+ii+1)<Min1);
+			Min1=Better?*(Ptr+ii+1):Min1;
+			MinIdx1=Better?(u16) (ii+1):MinIdx1;
+			Better=(*(Ptr+ii+1)>Max1);
+			Max1=Better?*(Ptr+ii+1):Max1;
+			MaxIdx1=Better?(u16) (ii+1):MaxIdx1;
+		}
+		if(ii<Num)
+		{
+			Better=(*(Ptr+ii)<Min0);
+			Min0=Better?*(Ptr+ii):Min0;
+			MinIdx0=Better?ii:MinIdx0;
+			Better=(*(Ptr+ii)>Max0);
+			Max0=Better?*(Ptr+ii):Max0;
+			MaxIdx0=Better?ii:MaxIdx0;
+		}
+		Better=(Min1<Min0)||((Min1==Min0)&&(MinIdx1<MinIdx0));
+		MinVal=Better?Min1:Min0;
+		ArgMin=Better?MinIdx1:MinIdx0;
+		Better=(Max1>Max0)||((Max1==Max0)&&(MaxIdx1<MaxIdx0));
+		MaxVal=Better?Max1:Max0;
+		ArgMax=Better?MaxIdx1:MaxIdx0;
+	}
+
+	//Sum of a Block
+	static Type _SumBlock(Type *Ptr, u8 Row, u16 Num, u8 Stride)
+	{
+		Type SumVal=0;
+		u8 ii;
+		for(ii=0;ii<Row;ii++)
+		{
+			SumVal+=_SumRun(Ptr,Num);
+			Ptr+=Stride;
+		}
+		return SumVal;
+	}
+
+	//Maximum or Minimum of a Block
+	static Type _ExtBlock(Type *Ptr, u8 Row, u16 Num, u8 Stride, bool Bigger)
+	{
+		Type ExtVal=*Ptr;
+		Type ExtContender;
+		u8 ii;
+		for(ii=0;ii<Row;ii++)
+		{
+			ExtContender=_ExtRun(Ptr,Num,Bigger);
+			ExtVal=((ExtContender>ExtVal)==Bigger)?ExtContender:ExtVal;
+			Ptr+=Stride;
+		}
+		return ExtVal;
+	}
+
+	//Fused Minimum and Maximum of a Block with First Positions (Positions are Offsets from Ptr with Stride)
+	static void _MinMaxBlock(Type *Ptr, u8 Row, u16 Num, u8 Stride, Type &MinVal, Type &MaxVal, u16 &ArgMin, u16 &ArgMax)
+	{
+		Type RunMin,RunMax;
+		u16 RunArgMin,RunArgMax;
+		u8 ii;
+		_MinMaxRun(Ptr,Num,MinVal,MaxVal,ArgMin,ArgMax);
+		for(ii=1;ii<Row;ii++)
+		{
+			_MinMaxRun(Ptr+((u16) ii)*Stride,Num,RunMin,RunMax,RunArgMin,RunArgMax);
+			if(RunMin<MinVal)
+			{
+				MinVal=RunMin;
+				ArgMin=((u16) ii)*Stride+RunArgMin;
+			}
+			if(RunMax>MaxVal)
+			{
+				MaxVal=RunMax;
+				ArgMax=((u16) ii)*Stride+RunArgMax;
+			}
+		}
+	}
+
+	//Check if a Plain Sum of Squares Neither Overflows nor Loses Precision by Underflow
+	static bool _SquareSafe(Type SquareSum)
+	{
+		return numeric_limits<Type>::is_integer||((SquareSum<=numeric_limits<Type>::max())&&(SquareSum>=numeric_limits<Type>::min()/numeric_limits<Type>::epsilon()));
+	}
+
+	//L2 Norm of a Block (Rescaled by the Maximum Magnitude if the Plain Sum of Squares Overflows or Underflows)
+	static Type _NormBlock(Type *Ptr, u8 Row, u16 Num, u8 Stride)
+	{
+		Type SquareSum=0;
+		Type Scale=0;
+		Type *RowPtr=Ptr;
+		u8 ii;
+		for(ii=0;ii<Row;ii++)
+		{
+			SquareSum+=_SquareRun(RowPtr,Num,1);
+			RowPtr+=Stride;
+		}
+		if(_SquareSafe(SquareSum))
+		{
+			return _Sqrt(SquareSum);
+		}
+
+		RowPtr=Ptr;
+		for(ii=0;ii<Row;ii++)
+		{
+			SquareSum=_AbsMaxRun(RowPtr,Num);
+			Scale=(SquareSum>Scale)?SquareSum:Scale;
+			RowPtr+=Stride;
+		}
+		if((Scale==0)||(!(Scale<=numeric_limits<Type>::max())))
+		{
+			return Scale;
+		}
+		SquareSum=0;
+		RowPtr=Ptr;
+		for(ii=0;ii<Row;ii++)
+		{
+			SquareSum+=_SquareRun(RowPtr,Num,1/Scale);
+			RowPtr+=Stride;
+		}
+		return Scale*_Sqrt(SquareSum);
+	}
+
 
-	bool _IsVector;//Indicate Vector Stat
-	bool _IsSquare;//Indicate Square Stat
-	bool _IsSingle;//Indicate Single Value Stat
+	//Element-wise Operation of Two Runs in One Pass
+	template <class Op>
+	static void _EleRun(Type *Out, Type *InL, Type *InR, u16 Num)
+	{
+		u16 ii;
+		for(ii=0;ii<Num;ii++)
+		{
+			*(Out+ii)=Op::Do(*(InL+ii),*(InR+ii));
+		}
+	}
 
-	bool _IsTemp;//Indicate Temperorary Status
-	bool _IsReturn;//Indicate Global Variable Status
+	//Broadcast Direction of a Vector over a Row x Col Matrix (1 for Row x 1, 2 for 1 x Col, 0 for Same Size or Other Shapes)
+	static u8 _BcDir(u8 Row, u8 Col, u8 VecRow, u8 VecCol)
+	{
+		if((VecRow==Row)&&(VecCol==Col))
+		{
+			return 0;
+		}
+		if((VecRow==Row)&&(VecCol==1))
+		{
+			return 1;
+		}
+		if((VecRow==1)&&(VecCol==Col))
+		{
+			return 2;
+		}
+		return 0;
+	}
 
-	Type *_Value;//Root Pointer
-	u8 _Row;//Number of Rows
-	u8 _Col;//Number of Columns
-	u16 _Size;//Number of Elements
+	//Broadcast a Column Vector (Row x 1, IsCol=1) or a Row Vector (1 x Col) over a Matrix in One Pass
+	template <class Op>
+	static void _Broadcast(Type *Out, Type *In, Type *Vec, u8 Row, u8 Col, bool IsCol)
+	{
+		Type Scalar;
+		u8 ii,jj;
+		for(ii=0;ii<Row;ii++)
+		{
+			if(IsCol)
+			{
+				Scalar=*(Vec+ii);
+				for(jj=0;jj<Col;jj++)
+				{
+					*(Out+jj)=Op::Do(*(In+jj),Scalar);
+				}
+			}
+			else
+			{
+				for(jj=0;jj<Col;jj++)
+				{
+					*(Out+jj)=Op::Do(*(In+jj),*(Vec+jj));
+				}
+			}
+			Out+=Col;
+			In+=Col;
+		}
+	}
 
 
 
@@ -234,8 +1419,11 @@ public://Functions
 		{
 #if _HEAPSCOPE
 			MiniMat_HeapScope._HeapMinus(((u32)sizeof(Type))*((u32)_Size));
+#if _HEAPTRACE
+			MiniMat_HeapScope._HeapUntrace(_Value);
 #endif
-			free(_Value);
+#endif
+			MatFree(_Value,((u32)sizeof(Type))*((u32)_Size));
 			_Value=NULL;
 		}
 		return;
@@ -248,8 +1436,11 @@ public://Functions
 		{
 #if _HEAPSCOPE
 			MiniMat_HeapScope._HeapMinus(((u32)sizeof(Type))*((u32)_Size));
+#if _HEAPTRACE
+			MiniMat_HeapScope._HeapUntrace(_Value);
+#endif
 #endif
-			free(_Value);
+			MatFree(_Value,((u32)sizeof(Type))*((u32)_Size));
 			_Value=NULL;
 		}
 		return;
@@ -408,6 +1599,12 @@ public://Functions
 		return *this;
 	}
 
+	//Set Elements to Same Value where Mask is True (Defined in MiniMatBits.hpp, This will destroy Mask if is Temp BitMat)
+	Mat<Type> & MaskedSet(BitMat Mask, Type Value);
+
+	//Copy Elements where Mask is True (Defined in MiniMatBits.hpp, This will destroy Inputs if are Temp)
+	Mat<Type> & MaskedSet(BitMat Mask, Mat<Type> SetMat);
+
 	//////End of Content operation
 
 
@@ -495,6 +1692,12 @@ public://Functions
 		return _Size*sizeof(Type);
 	}
 
+	//FeedBack Root Pointer (Used by Other MiniMat Types, Use with Caution)
+	Type * Pt()
+	{
+		return _Value;
+	}
+
 	//Extract Single Value
 	Type Val(u8 Row,u8 Col)
 	{
@@ -522,155 +1725,439 @@ public://Functions
 		u8 ii,jj;
 		for(ii=(RowLow-1);ii<RowHigh;ii++)
 		{
-			for(jj=(ColLow-1);jj<ColHigh;jj++)
+			for(jj=(ColLow-1);jj<ColHigh;jj++)
+			{
+				NewMat(ii-RowLow+2,jj-ColLow+2,*(_Value+ii*_Col+jj));
+			}
+		}
+
+		return NewMat;
+	}
+
+	//Extract Partial Matrix
+	Mat<Type> operator()(u8 RowLow, u8 RowHigh, u8 ColLow, u8 ColHigh)
+	{
+		u8 Row=RowHigh-RowLow+1;
+		u8 Col=ColHigh-ColLow+1;
+
+		RetMat(Type,NewMat,Row,Col);
+
+		u8 ii,jj;
+		for(ii=(RowLow-1);ii<RowHigh;ii++)
+		{
+			for(jj=(ColLow-1);jj<ColHigh;jj++)
+			{
+				NewMat(ii-RowLow+2,jj-ColLow+2,*(_Value+ii*_Col+jj));
+			}
+		}
+
+		CleanRet();
+
+		return NewMat;
+	};
+
+	//Calculate Maximum of All Elements
+	Type Max()
+	{
+		return _ExtBlock(_Value,1,_Size,0,1);
+	}
+
+	//Calculate Maximum of Partial Matrix (No Copy)
+	Type Max(u8 RowLow, u8 RowHigh, u8 ColLow, u8 ColHigh)
+	{
+		return _ExtBlock(_Value+(RowLow-1)*_Col+ColLow-1,RowHigh-RowLow+1,ColHigh-ColLow+1,_Col,1);
+	}
+
+	//Calculate Maximum of All Element
+	friend Type Max(Mat<Type> CalcMat)
+	{
+		MatProf(_PROF_REDUCE,((u32) sizeof(Type))*CalcMat._Size,CalcMat._Size);
+		Type MaxVal=_ExtBlock(CalcMat._Value,1,CalcMat._Size,0,1);
+
+		CalcMat.CleanRet();
+
+		return MaxVal;
+	}
+
+	//Calculate Minimum of All Elements
+	Type Min()
+	{
+		return _ExtBlock(_Value,1,_Size,0,0);
+	}
+
+	//Calculate Minimum of Partial Matrix (No Copy)
+	Type Min(u8 RowLow, u8 RowHigh, u8 ColLow, u8 ColHigh)
+	{
+		return _ExtBlock(_Value+(RowLow-1)*_Col+ColLow-1,RowHigh-RowLow+1,ColHigh-ColLow+1,_Col,0);
+	}
+
+	//Calculate Minimum of All Element
+	friend Type Min(Mat<Type> CalcMat)
+	{
+		MatProf(_PROF_REDUCE,((u32) sizeof(Type))*CalcMat._Size,CalcMat._Size);
+		Type MinVal=_ExtBlock(CalcMat._Value,1,CalcMat._Size,0,0);
+
+		CalcMat.CleanRet();
+
+		return MinVal;
+	}
+
+	//Calculate Minimum and Maximum in One Pass with Their First Positions (Positions are Row Major Index from 1)
+	void MinMax(Type &MinVal, Type &MaxVal, u16 &ArgMin, u16 &ArgMax)
+	{
+		_MinMaxBlock(_Value,1,_Size,0,MinVal,MaxVal,ArgMin,ArgMax);
+		ArgMin++;
+		ArgMax++;
+	}
+
+	//Calculate Minimum and Maximum of Partial Matrix in One Pass (No Copy, Positions are Row Major Index of the Whole Matrix from 1)
+	void MinMax(u8 RowLow, u8 RowHigh, u8 ColLow, u8 ColHigh, Type &MinVal, Type &MaxVal, u16 &ArgMin, u16 &ArgMax)
+	{
+		u16 Offset=(RowLow-1)*_Col+ColLow-1;
+		_MinMaxBlock(_Value+Offset,RowHigh-RowLow+1,ColHigh-ColLow+1,_Col,MinVal,MaxVal,ArgMin,ArgMax);
+		ArgMin+=Offset+1;
+		ArgMax+=Offset+1;
+	}
+
+	//Calculate Minimum and Maximum in One Pass with Their First Positions (Positions are Row Major Index from 1)
+	friend void MinMax(Mat<Type> CalcMat, Type &MinVal, Type &MaxVal, u16 &ArgMin, u16 &ArgMax)
+	{
+		CalcMat.MinMax(MinVal,MaxVal,ArgMin,ArgMax);
+
+		CalcMat.CleanRet();
+	}
+
+	//Position of the First Maximum (Row Major Index from 1)
+	u16 ArgMax()
+	{
+		Type MinVal,MaxVal;
+		u16 ArgMin,ArgMax;
+		MinMax(MinVal,MaxVal,ArgMin,ArgMax);
+		return ArgMax;
+	}
+
+	//Position of the First Minimum (Row Major Index from 1)
+	u16 ArgMin()
+	{
+		Type MinVal,MaxVal;
+		u16 ArgMin,ArgMax;
+		MinMax(MinVal,MaxVal,ArgMin,ArgMax);
+		return ArgMin;
+	}
+
+	//Calculate Sum of All Element (Well be useless if is boolean)
+	Type Sum()
+	{
+		return _SumBlock(_Value,1,_Size,0);
+	}
+
+	//Calculate Sum of Partial Matrix (No Copy)
+	Type Sum(u8 RowLow, u8 RowHigh, u8 ColLow, u8 ColHigh)
+	{
+		return _SumBlock(_Value+(RowLow-1)*_Col+ColLow-1,RowHigh-RowLow+1,ColHigh-ColLow+1,_Col);
+	}
+
+	//Calculate Sum of All Element (Well be useless if is boolean)
+	friend Type Sum(Mat<Type> CalcMat)
+	{
+		MatProf(_PROF_REDUCE,((u32) sizeof(Type))*CalcMat._Size,CalcMat._Size);
+		Type SumVal=_SumBlock(CalcMat._Value,1,CalcMat._Size,0);
+
+		CalcMat.CleanRet();
+
+		return SumVal;
+	}
+
+	//Calculate L2 Norm of the whole Vector or sqrt(sum(x^2)) of the whole Matrix (Overflow Safe, Will be Error if is not float)
+	Type Norm()
+	{
+		return _NormBlock(_Value,1,_Size,0);
+	}
+
+	//Calculate L2 Norm of Partial Matrix (No Copy, Overflow Safe, Will be Error if is not float)
+	Type Norm(u8 RowLow, u8 RowHigh, u8 ColLow, u8 ColHigh)
+	{
+		return _NormBlock(_Value+(RowLow-1)*_Col+ColLow-1,RowHigh-RowLow+1,ColHigh-ColLow+1,_Col);
+	}
+
+	//Calculate L2 Norm of the whole Vector or sqrt(sum(x^2)) of the whole Matrix (Overflow Safe, Will be Error if is not float)
+	friend Type Norm(Mat<Type> CalcMat)
+	{
+		MatProf(_PROF_REDUCE,((u32) sizeof(Type))*CalcMat._Size,2*((u32) CalcMat._Size));
+		Type NormVal=_NormBlock(CalcMat._Value,1,CalcMat._Size,0);
+
+		CalcMat.CleanRet();
+
+		return NormVal;
+	}
+
+	//Calculate Sum of Each Row (Row x 1)
+	Mat<Type> RowSum()
+	{
+		RetMat(Type,NewMat,_Row,1);
+		u8 ii;
+		for(ii=0;ii<_Row;ii++)
+		{
+			*(NewMat._Value+ii)=_SumRun(_Value+((u16) ii)*_Col,_Col);
+		}
+		return NewMat;
+	}
+
+	//Calculate Sum of Each Column (1 x Col)
+	Mat<Type> ColSum()
+	{
+		RetMat(Type,NewMat,1,_Col);
+		Type *_Ptr1=_Value;
+		u8 ii,jj;
+		for(jj=0;jj<_Col;jj++)
+		{
+			*(NewMat._Value+jj)=*(_Ptr1+jj);
+		}
+		for(ii=1;ii<_Row;ii++)
+		{
+			_Ptr1+=_Col;
+			for(jj=0;jj<_Col;jj++)
+			{
+				*(NewMat._Value+jj)+=*(_Ptr1+jj);
+			}
+		}
+		return NewMat;
+	}
+
+	//Calculate Mean of Each Row (Row x 1)
+	Mat<Type> RowMean()
+	{
+		Mat<Type> NewMat=RowSum();
+		Type Count=(Type) _Col;
+		u8 ii;
+		for(ii=0;ii<_Row;ii++)
+		{
+			*(NewMat._Value+ii)=(*(NewMat._Value+ii))/Count;
+		}
+		return NewMat;
+	}
+
+	//Calculate Mean of Each Column (1 x Col)
+	Mat<Type> ColMean()
+	{
+		Mat<Type> NewMat=ColSum();
+		Type Count=(Type) _Row;
+		u8 jj;
+		for(jj=0;jj<_Col;jj++)
+		{
+			*(NewMat._Value+jj)=(*(NewMat._Value+jj))/Count;
+		}
+		return NewMat;
+	}
+
+	//Calculate Maximum of Each Row (Row x 1)
+	Mat<Type> RowMax()
+	{
+		RetMat(Type,NewMat,_Row,1);
+		u8 ii;
+		for(ii=0;ii<_Row;ii++)
+		{
+			*(NewMat._Value+ii)=_ExtRun(_Value+((u16) ii)*_Col,_Col,1);
+		}
+		return NewMat;
+	}
+
+	//Calculate Maximum of Each Column (1 x Col)
+	Mat<Type> ColMax()
+	{
+		RetMat(Type,NewMat,1,_Col);
+		Type *_Ptr1=_Value;
+		u8 ii,jj;
+		for(jj=0;jj<_Col;jj++)
+		{
+			*(NewMat._Value+jj)=*(_Ptr1+jj);
+		}
+		for(ii=1;ii<_Row;ii++)
+		{
+			_Ptr1+=_Col;
+			for(jj=0;jj<_Col;jj++)
+			{
+				*(NewMat._Value+jj)=(*(_Ptr1+jj)>*(NewMat._Value+jj))?*(_Ptr1+jj):*(NewMat._Value+jj);
+			}
+		}
+		return NewMat;
+	}
+
+	//Calculate Minimum of Each Row (Row x 1)
+	Mat<Type> RowMin()
+	{
+		RetMat(Type,NewMat,_Row,1);
+		u8 ii;
+		for(ii=0;ii<_Row;ii++)
+		{
+			*(NewMat._Value+ii)=_ExtRun(_Value+((u16) ii)*_Col,_Col,0);
+		}
+		return NewMat;
+	}
+
+	//Calculate Minimum of Each Column (1 x Col)
+	Mat<Type> ColMin()
+	{
+		RetMat(Type,NewMat,1,_Col);
+		Type *_Ptr1=_Value;
+		u8 ii,jj;
+		for(jj=0;jj<_Col;jj++)
+		{
+			*(NewMat._Value+jj)=*(_Ptr1+jj);
+		}
+		for(ii=1;ii<_Row;ii++)
+		{
+			_Ptr1+=_Col;
+			for(jj=0;jj<_Col;jj++)
+			{
+				*(NewMat._Value+jj)=(*(_Ptr1+jj)<*(NewMat._Value+jj))?*(_Ptr1+jj):*(NewMat._Value+jj);
+			}
+		}
+		return NewMat;
+	}
+
+	//Calculate L2 Norm of Each Row (Row x 1, Overflow Safe, Will be Error if is not float)
+	Mat<Type> RowNorm()
+	{
+		RetMat(Type,NewMat,_Row,1);
+		u8 ii;
+		for(ii=0;ii<_Row;ii++)
+		{
+			*(NewMat._Value+ii)=_NormBlock(_Value+((u16) ii)*_Col,1,_Col,0);
+		}
+		return NewMat;
+	}
+
+	//Calculate L2 Norm of Each Column (1 x Col, Overflow Safe, Will be Error if is not float)
+	Mat<Type> ColNorm()
+	{
+		RetMat(Type,NewMat,1,_Col);
+		Type *_Ptr1=_Value;
+		u8 ii,jj;
+		for(jj=0;jj<_Col;jj++)
+		{
+			*(NewMat._Value+jj)=0;
+		}
+		for(ii=0;ii<_Row;ii++)
+		{
+			for(jj=0;jj<_Col;jj++)
 			{
-				NewMat(ii-RowLow+2,jj-ColLow+2,*(_Value+ii*_Col+jj));
+				*(NewMat._Value+jj)+=(*(_Ptr1+jj))*(*(_Ptr1+jj));
+			}
+			_Ptr1+=_Col;
+		}
+		for(jj=0;jj<_Col;jj++)
+		{
+			if(_SquareSafe(*(NewMat._Value+jj)))
+			{
+				*(NewMat._Value+jj)=_Sqrt(*(NewMat._Value+jj));
+			}
+			else
+			{
+				*(NewMat._Value+jj)=_NormBlock(_Value+jj,_Row,1,_Col);
 			}
 		}
-
 		return NewMat;
 	}
 
-	//Extract Partial Matrix
-	Mat<Type> operator()(u8 RowLow, u8 RowHigh, u8 ColLow, u8 ColHigh)
+	//Calculate Sum of Each Row (This will destory Operated Matrix if it is Temp Mat)
+	friend Mat<Type> RowSum(Mat<Type> CalcMat)
 	{
-		u8 Row=RowHigh-RowLow+1;
-		u8 Col=ColHigh-ColLow+1;
+		Mat<Type> NewMat=CalcMat.RowSum();
 
-		RetMat(Type,NewMat,Row,Col);
+		CalcMat.CleanRet();
 
-		u8 ii,jj;
-		for(ii=(RowLow-1);ii<RowHigh;ii++)
-		{
-			for(jj=(ColLow-1);jj<ColHigh;jj++)
-			{
-				NewMat(ii-RowLow+2,jj-ColLow+2,*(_Value+ii*_Col+jj));
-			}
-		}
+		return NewMat;
+	}
 
-		CleanRet();
+	//Calculate Sum of Each Column (This will destory Operated Matrix if it is Temp Mat)
+	friend Mat<Type> ColSum(Mat<Type> CalcMat)
+	{
+		Mat<Type> NewMat=CalcMat.ColSum();
+
+		CalcMat.CleanRet();
 
 		return NewMat;
-	};
+	}
 
-	//Calculate Maximum of All Elements
-	Type Max()
+	//Calculate Mean of Each Row (This will destory Operated Matrix if it is Temp Mat)
+	friend Mat<Type> RowMean(Mat<Type> CalcMat)
 	{
-		Type MaxVal=*_Value;
-		Type MaxContender;
-		u16 ii;
-		for(ii=1;ii<_Size;ii++)
-		{
-			MaxContender=(*(_Value+ii));
-			MaxVal=(MaxVal>MaxContender)?MaxVal:MaxContender;
-		}
+		Mat<Type> NewMat=CalcMat.RowMean();
 
-		return MaxVal;
+		CalcMat.CleanRet();
+
+		return NewMat;
 	}
 
-	//Calculate Maximum of All Element
-	friend Type Max(Mat<Type> CalcMat)
+	//Calculate Mean of Each Column (This will destory Operated Matrix if it is Temp Mat)
+	friend Mat<Type> ColMean(Mat<Type> CalcMat)
 	{
-		Type MaxVal=*CalcMat._Value;
-		Type MaxContender;
-		u16 ii;
-		for(ii=1;ii<CalcMat._Size;ii++)
-		{
-			MaxContender=(*(CalcMat._Value+ii));
-			MaxVal=(MaxVal>MaxContender)?MaxVal:MaxContender;
-		}
+		Mat<Type> NewMat=CalcMat.ColMean();
 
 		CalcMat.CleanRet();
 
-		return MaxVal;
+		return NewMat;
 	}
 
-	//Calculate Minimum of All Elements
-	Type Min()
+	//Calculate Maximum of Each Row (This will destory Operated Matrix if it is Temp Mat)
+	friend Mat<Type> RowMax(Mat<Type> CalcMat)
 	{
-		Type MinVal=*_Value;
-		Type MinContender;
+		Mat<Type> NewMat=CalcMat.RowMax();
 
-		u16 ii;
-		for(ii=1;ii<_Size;ii++)
-		{
-			MinContender=(*(_Value+ii));
-			MinVal=(MinVal<MinContender)?MinVal:MinContender;
-		}
+		CalcMat.CleanRet();
 
-		return MinVal;
+		return NewMat;
 	}
 
-	//Calculate Minimum of All Element
-	friend Type Min(Mat<Type> CalcMat)
+	//Calculate Maximum of Each Column (This will destory Operated Matrix if it is Temp Mat)
+	friend Mat<Type> ColMax(Mat<Type> CalcMat)
 	{
-		Type MinVal=*CalcMat._Value;
-		Type MinContender;
-		u16 ii;
-		for(ii=1;ii<CalcMat._Size;ii++)
-		{
-			MinContender=(*(CalcMat._Value+ii));
-			MinVal=(MinVal<MinContender)?MinVal:MinContender;
-		}
+		Mat<Type> NewMat=CalcMat.ColMax();
 
 		CalcMat.CleanRet();
 
-		return MinVal;
+		return NewMat;
 	}
 
-	//Calculate Sum of All Element (Well be useless if is boolean)
-	Type Sum()
-	{	Type Sum=0;
-			u16 ii;
-			for(ii=0;ii<_Size;ii++)
-			{
-				Sum+=*(_Value+ii);
-			}
+	//Calculate Minimum of Each Row (This will destory Operated Matrix if it is Temp Mat)
+	friend Mat<Type> RowMin(Mat<Type> CalcMat)
+	{
+		Mat<Type> NewMat=CalcMat.RowMin();
+
+		CalcMat.CleanRet();
 
-		return Sum;
+		return NewMat;
 	}
 
-	//Calculate Sum of All Element (Well be useless if is boolean)
-	friend Type Sum(Mat<Type> CalcMat)
+	//Calculate Minimum of Each Column (This will destory Operated Matrix if it is Temp Mat)
+	friend Mat<Type> ColMin(Mat<Type> CalcMat)
 	{
-		Type Sum=0;
-		u16 ii;
-		for(ii=0;ii<CalcMat._Size;ii++)
-		{
-			Sum+=*(CalcMat._Value+ii);
-		}
+		Mat<Type> NewMat=CalcMat.ColMin();
 
 		CalcMat.CleanRet();
 
-		return Sum;
+		return NewMat;
 	}
 
-	//Calculate L2 Norm of the whole Vector or sqrt(sum(x^2)) of the whole Matrix (Will be Error if is not float)
-	Type Norm()
+	//Calculate L2 Norm of Each Row (This will destory Operated Matrix if it is Temp Mat)
+	friend Mat<Type> RowNorm(Mat<Type> CalcMat)
 	{
-		Type SquareSum=0;
-		u16 ii;
-		for(ii=0;ii<_Size;ii++)
-		{
-			SquareSum+=powf(*(_Value+ii),2);
-		}
+		Mat<Type> NewMat=CalcMat.RowNorm();
+
+		CalcMat.CleanRet();
 
-		return sqrtf(SquareSum);
+		return NewMat;
 	}
 
-	//Calculate L2 Norm of the whole Vector or sqrt(sum(x^2)) of the whole Matrix (Will be Error if is not float)
-	friend Type Norm(Mat<Type> CalcMat)
+	//Calculate L2 Norm of Each Column (This will destory Operated Matrix if it is Temp Mat)
+	friend Mat<Type> ColNorm(Mat<Type> CalcMat)
 	{
-		Type SquareSum=0;
-		u16 ii;
-		for(ii=0;ii<CalcMat._Size;ii++)
-		{
-			SquareSum+=powf(*(CalcMat._Value+ii),2);
-		}
+		Mat<Type> NewMat=CalcMat.ColNorm();
 
 		CalcMat.CleanRet();
 
-		return sqrtf(SquareSum);
+		return NewMat;
 	}
 
 	//Calculate Absolution of All Elements
@@ -781,6 +2268,7 @@ public://Functions
 	//*Get SubMatrix of an Element (Will be wrong if not satisfying type requirement)
 	friend Mat<Type> Sub(Mat<Type> CalcMat,u8 Row, u8 Col)
 	{
+		MatProf(_PROF_SUB,((u32) sizeof(Type))*2*CalcMat._Size,0);
 		if ((CalcMat._Row>=2)&&(CalcMat._Col>=2))
 		{
 
@@ -910,6 +2398,7 @@ public://Functions
 	//Calculate Determinant (Return 0 if not satisfying size requirement)
 	friend Type Det(Mat<Type> CalcMat)
 	{
+		MatProf(_PROF_DET,((u32) sizeof(Type))*CalcMat._Size,0);
 		if((!CalcMat._IsSquare))
 		{
 			CalcMat.CleanRet();
@@ -973,6 +2462,7 @@ public://Functions
 	//Calculate Transpose
 	Mat<Type> Trans()
 	{
+		MatProf(_PROF_TRANS,((u32) sizeof(Type))*2*_Size,0);
 		RetMat(Type,NewMat,_Col,_Row);
 
 		Type *_Ptr1=_Value;
@@ -993,6 +2483,7 @@ public://Functions
 	//Calculate Transpose (This will destory Operated Matrix if it is Temp Mat)
 	Mat<Type> operator~()
 	{
+		MatProf(_PROF_TRANS,((u32) sizeof(Type))*2*_Size,0);
 		RetMat(Type,NewMat,_Col,_Row);
 
 		Type *_Ptr1=_Value;
@@ -1015,6 +2506,7 @@ public://Functions
 	//Calculate Inverse (Inverse Matrix for Float Types, Reverse for Bool Types, Return back to Itself unchanged for others)
 	Mat<Type> Inv()
 	{
+		MatProf(_PROF_INV,((u32) sizeof(Type))*2*_Size,0);
 		if(_IsSingle)
 		{
 			RetMat(Type,InvMat,_Row,_Col);
@@ -1066,6 +2558,7 @@ public://Functions
 	//*Calculate Inverse (Inverse Matrix for Float Types, Reverse for Bool Types, Return back to Itself unchanged for others)
 	Mat<Type> operator!()
 	{
+		MatProf(_PROF_INV,((u32) sizeof(Type))*2*_Size,0);
 		if(_IsSingle)
 		{
 			RetMat(Type,InvMat,_Row,_Col);
@@ -1176,21 +2669,30 @@ public://Functions
 
 	//////Interaction Between Matrixes
 
-	//Calculate Plus
+	//Calculate Plus (Right Side Row x 1 or 1 x Col Vector is Broadcast over Every Column or Row, Other Shapes are not Supported)
 	friend Mat<Type> operator+(Mat<Type> CalcMatL, Mat<Type> CalcMatR)
 	{
-		RetMat(Type,NewMat,CalcMatL._Row,CalcMatR._Col);
+		MatProf(_PROF_PLUS,((u32) sizeof(Type))*3*CalcMatL._Size,CalcMatL._Size);
+		u8 Dir=_BcDir(CalcMatL._Row,CalcMatL._Col,CalcMatR._Row,CalcMatR._Col);
+		RetMat(Type,NewMat,CalcMatL._Row,(Dir?CalcMatL._Col:CalcMatR._Col));
 		Type *LPtr=CalcMatL._Value;
 		Type *RPtr=CalcMatR._Value;
 		u8 ii,jj;
 
-		for (ii=1;ii<=NewMat._Row;ii++)
+		if(Dir)
 		{
-			for (jj=1;jj<=NewMat._Col;jj++)
+			_Broadcast<_OpPlus>(NewMat._Value,LPtr,RPtr,CalcMatL._Row,CalcMatL._Col,(Dir==1));
+		}
+		else
+		{
+			for (ii=1;ii<=NewMat._Row;ii++)
 			{
-				NewMat(ii,jj,(*LPtr+*RPtr));
-				LPtr++;
-				RPtr++;
+				for (jj=1;jj<=NewMat._Col;jj++)
+				{
+					NewMat(ii,jj,(*LPtr+*RPtr));
+					LPtr++;
+					RPtr++;
+				}
 			}
 		}
 
@@ -1200,21 +2702,30 @@ public://Functions
 		return NewMat;
 	}
 
-	//Calculate Minus
+	//Calculate Minus (Right Side Row x 1 or 1 x Col Vector is Broadcast over Every Column or Row, Other Shapes are not Supported)
 	friend Mat<Type> operator-(Mat<Type> CalcMatL, Mat<Type> CalcMatR)
 	{
-		RetMat(Type,NewMat,CalcMatL._Row,CalcMatR._Col);
+		MatProf(_PROF_MINUS,((u32) sizeof(Type))*3*CalcMatL._Size,CalcMatL._Size);
+		u8 Dir=_BcDir(CalcMatL._Row,CalcMatL._Col,CalcMatR._Row,CalcMatR._Col);
+		RetMat(Type,NewMat,CalcMatL._Row,(Dir?CalcMatL._Col:CalcMatR._Col));
 		Type *LPtr=CalcMatL._Value;
 		Type *RPtr=CalcMatR._Value;
 		u8 ii,jj;
 
-		for (ii=1;ii<=NewMat._Row;ii++)
+		if(Dir)
 		{
-			for (jj=1;jj<=NewMat._Col;jj++)
+			_Broadcast<_OpMinus>(NewMat._Value,LPtr,RPtr,CalcMatL._Row,CalcMatL._Col,(Dir==1));
+		}
+		else
+		{
+			for (ii=1;ii<=NewMat._Row;ii++)
 			{
-				NewMat(ii,jj,(*LPtr-*RPtr));
-				LPtr++;
-				RPtr++;
+				for (jj=1;jj<=NewMat._Col;jj++)
+				{
+					NewMat(ii,jj,(*LPtr-*RPtr));
+					LPtr++;
+					RPtr++;
+				}
 			}
 		}
 
@@ -1224,28 +2735,115 @@ public://Functions
 		return NewMat;
 	}
 
+	//Calculate Broadcast Multiply by a Row x 1 or 1 x Col Vector to Scale Every Row or Column (Same Size is Element-wise, Other Shapes are not Supported)
+	friend Mat<Type> BcMult(Mat<Type> CalcMat, Mat<Type> CalcVec)
+	{
+		RetMat(Type,NewMat,CalcMat._Row,CalcMat._Col);
+		u8 Dir=_BcDir(CalcMat._Row,CalcMat._Col,CalcVec._Row,CalcVec._Col);
+		if(Dir)
+		{
+			_Broadcast<_OpMult>(NewMat._Value,CalcMat._Value,CalcVec._Value,CalcMat._Row,CalcMat._Col,(Dir==1));
+		}
+		else
+		{
+			_EleRun<_OpMult>(NewMat._Value,CalcMat._Value,CalcVec._Value,CalcMat._Size);
+		}
+
+		CalcMat.CleanRet();
+		CalcVec.CleanRet();
+
+		return NewMat;
+	}
+
+	//Calculate Broadcast Devide by a Row x 1 or 1 x Col Vector (Same Size is Element-wise, Other Shapes are not Supported)
+	friend Mat<Type> BcDiv(Mat<Type> CalcMat, Mat<Type> CalcVec)
+	{
+		RetMat(Type,NewMat,CalcMat._Row,CalcMat._Col);
+		u8 Dir=_BcDir(CalcMat._Row,CalcMat._Col,CalcVec._Row,CalcVec._Col);
+		if(Dir)
+		{
+			_Broadcast<_OpDiv>(NewMat._Value,CalcMat._Value,CalcVec._Value,CalcMat._Row,CalcMat._Col,(Dir==1));
+		}
+		else
+		{
+			_EleRun<_OpDiv>(NewMat._Value,CalcMat._Value,CalcVec._Value,CalcMat._Size);
+		}
+
+		CalcMat.CleanRet();
+		CalcVec.CleanRet();
+
+		return NewMat;
+	}
+
+	//Calculate Element-wise Multiply (Hadamard Product)
+	friend Mat<Type> Hadamard(Mat<Type> CalcMatL, Mat<Type> CalcMatR)
+	{
+		RetMat(Type,NewMat,CalcMatL._Row,CalcMatL._Col);
+		_EleRun<_OpMult>(NewMat._Value,CalcMatL._Value,CalcMatR._Value,NewMat._Size);
+
+		CalcMatL.CleanRet();
+		CalcMatR.CleanRet();
+
+		return NewMat;
+	}
+
+	//Calculate Element-wise Devide
+	friend Mat<Type> EleDiv(Mat<Type> CalcMatL, Mat<Type> CalcMatR)
+	{
+		RetMat(Type,NewMat,CalcMatL._Row,CalcMatL._Col);
+		_EleRun<_OpDiv>(NewMat._Value,CalcMatL._Value,CalcMatR._Value,NewMat._Size);
+
+		CalcMatL.CleanRet();
+		CalcMatR.CleanRet();
+
+		return NewMat;
+	}
+
+	//Calculate Fused Element-wise Multiply and Plus A.*B+C in One Pass
+	friend Mat<Type> FMA(Mat<Type> CalcMatA, Mat<Type> CalcMatB, Mat<Type> CalcMatC)
+	{
+		RetMat(Type,NewMat,CalcMatA._Row,CalcMatA._Col);
+		Type *OPtr=NewMat._Value;
+		Type *APtr=CalcMatA._Value;
+		Type *BPtr=CalcMatB._Value;
+		Type *CPtr=CalcMatC._Value;
+		u16 ii;
+
+		for(ii=0;ii<NewMat._Size;ii++)
+		{
+			*(OPtr+ii)=(*(APtr+ii))*(*(BPtr+ii))+(*(CPtr+ii));
+		}
+
+		CalcMatA.CleanRet();
+		CalcMatB.CleanRet();
+		CalcMatC.CleanRet();
+
+		return NewMat;
+	}
+
 	//Calculate Multiply
 	friend Mat<Type> operator*(Mat<Type> CalcMatL, Mat<Type> CalcMatR)
 	{
+		MatProf(_PROF_MULT,((u32) sizeof(Type))*(((u32) CalcMatL._Size)+CalcMatR._Size+((u32) CalcMatL._Row)*CalcMatR._Col),2*((u32) CalcMatL._Row)*CalcMatR._Col*CalcMatL._Col);
 		RetMat(Type,NewMat,CalcMatL._Row,CalcMatR._Col);
 		Type *LPtr,*RPtr;
-		Type MultSum=0;
+		typename MiniMat_Acc<Type>::Acc MultSum=MiniMat_Acc<Type>::Zero();
 		u8 ii,jj,kk;
 
 		for (ii=1;ii<=CalcMatL._Row;ii++)
 		{
 			for (jj=1;jj<=CalcMatR._Col;jj++)
 			{
-				LPtr=CalcMatL._Value+(ii-1)*CalcMatR._Col;
+				LPtr=CalcMatL._Value+(ii-1)*CalcMatL._Col;
 				RPtr=CalcMatR._Value+jj-1;
 				for (kk=1;kk<=CalcMatL._Col;kk++)
 				{
-					MultSum+=(*LPtr)*(*RPtr);
+					MiniMat_Acc<Type>::Mac(MultSum,*LPtr,*RPtr);
 					LPtr++;
 					RPtr+=CalcMatR._Col;
 				}
-				NewMat(ii,jj,MultSum);
-				MultSum=0;
+				NewMat(ii,jj,MiniMat_Acc<Type>::Out(MultSum));
+				MultSum=MiniMat_Acc<Type>::Zero();
 			}
 		}
 
@@ -1256,12 +2854,20 @@ public://Functions
 		return NewMat;
 	}
 
-	//Calculate Equal from Plus
+	//Calculate Equal from Plus (Row x 1 or 1 x Col Vector is Broadcast over Every Column or Row, Other Shapes are not Supported)
 	Mat<Type> & operator+=(Mat<Type> CalcMat)
 	{
 		Type *LPtr=_Value;
 		Type *RPtr=CalcMat._Value;
 		u8 ii,jj;
+		u8 Dir=_BcDir(_Row,_Col,CalcMat._Row,CalcMat._Col);
+
+		if(Dir)
+		{
+			_Broadcast<_OpPlus>(_Value,_Value,RPtr,_Row,_Col,(Dir==1));
+			CalcMat.CleanRet();
+			return *this;
+		}
 
 		for (ii=1;ii<=_Row;ii++)
 		{
@@ -1279,12 +2885,20 @@ public://Functions
 		return *this;
 	}
 
-	//Calculate Equal from Minus
+	//Calculate Equal from Minus (Row x 1 or 1 x Col Vector is Broadcast over Every Column or Row, Other Shapes are not Supported)
 	Mat<Type> & operator-=(Mat<Type> CalcMat)
 	{
 		Type *LPtr=_Value;
 		Type *RPtr=CalcMat._Value;
 		u8 ii,jj;
+		u8 Dir=_BcDir(_Row,_Col,CalcMat._Row,CalcMat._Col);
+
+		if(Dir)
+		{
+			_Broadcast<_OpMinus>(_Value,_Value,RPtr,_Row,_Col,(Dir==1));
+			CalcMat.CleanRet();
+			return *this;
+		}
 
 
 		for (ii=1;ii<=_Row;ii++)
@@ -1307,7 +2921,7 @@ public://Functions
 	Mat<Type> & operator*=(Mat<Type> CalcMat)
 	{
 		Type *LPtr,*RPtr;
-		Type MultSum=0;
+		typename MiniMat_Acc<Type>::Acc MultSum=MiniMat_Acc<Type>::Zero();
 		u8 ii,jj,kk;
 
 		for (ii=1;ii<=_Row;ii++)
@@ -1318,12 +2932,12 @@ public://Functions
 				RPtr=CalcMat._Value+jj-1;
 				for (kk=1;kk<=_Col;kk++)
 				{
-					MultSum+=(*LPtr)*(*RPtr);
+					MiniMat_Acc<Type>::Mac(MultSum,*LPtr,*RPtr);
 					LPtr++;
 					RPtr+=CalcMat._Col;
 				}
-				this->operator ()(ii,jj,MultSum);
-				MultSum=0;
+				this->operator ()(ii,jj,MiniMat_Acc<Type>::Out(MultSum));
+				MultSum=MiniMat_Acc<Type>::Zero();
 			}
 		}
 
@@ -1332,10 +2946,137 @@ public://Functions
 		return *this;
 	}
 
+	//Calculate Equal from Scale Itself by Alpha (BLAS SCAL, No Temp Mat)
+	Mat<Type> & Scal(Type Alpha)
+	{
+		Type *LPtr=_Value;
+		u16 ii;
+
+		for (ii=0;ii<_Size;ii++)
+		{
+			*(LPtr+ii)=Alpha*(*(LPtr+ii));
+		}
+
+		return *this;
+	}
+
+	//Calculate Equal from Alpha*X+Itself (BLAS AXPY, No Temp Mat)
+	Mat<Type> & Axpy(Type Alpha, Mat<Type> CalcMat)
+	{
+		Type *LPtr=_Value;
+		Type *XPtr=CalcMat._Value;
+		u16 ii;
+
+		for (ii=0;ii<_Size;ii++)
+		{
+			*(LPtr+ii)+=Alpha*(*(XPtr+ii));
+		}
+
+		CalcMat.CleanRet();
+
+		return *this;
+	}
+
+	//Calculate Equal from Alpha*X+Beta*Itself (BLAS AXPBY, No Temp Mat)
+	Mat<Type> & Axpby(Type Alpha, Mat<Type> CalcMat, Type Beta)
+	{
+		Type *LPtr=_Value;
+		Type *XPtr=CalcMat._Value;
+		u16 ii;
+
+		for (ii=0;ii<_Size;ii++)
+		{
+			*(LPtr+ii)=Alpha*(*(XPtr+ii))+Beta*(*(LPtr+ii));
+		}
+
+		CalcMat.CleanRet();
+
+		return *this;
+	}
+
+	//Calculate Equal from Alpha*A*X+Beta*Itself (BLAS GEMV, Itself is Row of A x 1, X Must not Share Memory with Itself)
+	Mat<Type> & Gemv(Type Alpha, Mat<Type> CalcMatA, Mat<Type> CalcMatX, Type Beta)
+	{
+		Type *APtr=CalcMatA._Value;
+		Type *XPtr;
+		Type *YPtr=_Value;
+		typename MiniMat_Acc<Type>::Acc MultSum;
+		u8 ii,kk;
+
+		for (ii=0;ii<CalcMatA._Row;ii++)
+		{
+			MultSum=MiniMat_Acc<Type>::Zero();
+			XPtr=CalcMatX._Value;
+			for (kk=0;kk<CalcMatA._Col;kk++)
+			{
+				MiniMat_Acc<Type>::Mac(MultSum,*APtr,*XPtr);
+				APtr++;
+				XPtr++;
+			}
+			//Same as BLAS, Beta=0 Overwrites Itself without Reading It
+			if(Beta==0)
+			{
+				*YPtr=Alpha*MiniMat_Acc<Type>::Out(MultSum);
+			}
+			else
+			{
+				*YPtr=Alpha*MiniMat_Acc<Type>::Out(MultSum)+Beta*(*YPtr);
+			}
+			YPtr++;
+		}
+
+		CalcMatA.CleanRet();
+		CalcMatX.CleanRet();
+
+		return *this;
+	}
+
+	//Calculate Equal from Alpha*A*B+Beta*Itself (BLAS GEMM, Itself is Row of A x Col of B, A and B Must not Share Memory with Itself)
+	Mat<Type> & Gemm(Type Alpha, Mat<Type> CalcMatA, Mat<Type> CalcMatB, Type Beta)
+	{
+		Type *ARow=CalcMatA._Value;
+		Type *APtr,*BPtr;
+		Type *YPtr=_Value;
+		typename MiniMat_Acc<Type>::Acc MultSum;
+		u8 ii,jj,kk;
+
+		for (ii=0;ii<CalcMatA._Row;ii++)
+		{
+			for (jj=0;jj<CalcMatB._Col;jj++)
+			{
+				MultSum=MiniMat_Acc<Type>::Zero();
+				APtr=ARow;
+				BPtr=CalcMatB._Value+jj;
+				for (kk=0;kk<CalcMatA._Col;kk++)
+				{
+					MiniMat_Acc<Type>::Mac(MultSum,*APtr,*BPtr);
+					APtr++;
+					BPtr+=CalcMatB._Col;
+				}
+				if(Beta==0)
+				{
+					*YPtr=Alpha*MiniMat_Acc<Type>::Out(MultSum);
+				}
+				else
+				{
+					*YPtr=Alpha*MiniMat_Acc<Type>::Out(MultSum)+Beta*(*YPtr);
+				}
+				YPtr++;
+			}
+			ARow+=CalcMatA._Col;
+		}
+
+		CalcMatA.CleanRet();
+		CalcMatB.CleanRet();
+
+		return *this;
+	}
+
 	//Calculate Point Product
 	friend Type Point(Mat<Type> CalcMatL, Mat<Type> CalcMatR)
 	{
-		Type SumVal=0;
+		MatProf(_PROF_POINT,((u32) sizeof(Type))*2*CalcMatL._Size,2*((u32) CalcMatL._Size));
+		typename MiniMat_Acc<Type>::Acc SumVal=MiniMat_Acc<Type>::Zero();
 		Type *LPtr=CalcMatL._Value;
 		Type *RPtr=CalcMatR._Value;
 		u8 ii,jj;
@@ -1344,7 +3085,7 @@ public://Functions
 		{
 			for (jj=1;jj<=CalcMatR._Col;jj++)
 			{
-				SumVal+=((*LPtr)*(*RPtr));
+				MiniMat_Acc<Type>::Mac(SumVal,*LPtr,*RPtr);
 				LPtr++;
 				RPtr++;
 			}
@@ -1353,12 +3094,13 @@ public://Functions
 		CalcMatL.CleanRet();
 		CalcMatR.CleanRet();
 
-		return SumVal;
+		return MiniMat_Acc<Type>::Out(SumVal);
 	}
 
 	//Calculate Cross Product
 	friend Mat<Type> Cross(Mat<Type> CalcMatL, Mat<Type> CalcMatR)
 	{
+		MatProf(_PROF_CROSS,((u32) sizeof(Type))*9,9);
 		RetMat(Type,NewMat,3,1);
 		if(CalcMatL._IsVector&&CalcMatR._IsVector&&(CalcMatL._Size==3)&&(CalcMatR._Size=3))
 		{
@@ -1381,6 +3123,7 @@ public://Functions
 	//Calculate Plus
 	friend Mat<Type> operator+(Mat<Type> CalcMat, Type CalcValue)
 	{
+		MatProf(_PROF_SCALAR,((u32) sizeof(Type))*2*CalcMat._Size,CalcMat._Size);
 		RetMat(Type,NewMat,CalcMat._Row,CalcMat._Col);
 		Type *LPtr=CalcMat._Value;
 		u8 ii,jj;
@@ -1402,6 +3145,7 @@ public://Functions
 	//Calculate Minus
 	friend Mat<Type> operator-(Mat<Type> CalcMat, Type CalcValue)
 	{
+		MatProf(_PROF_SCALAR,((u32) sizeof(Type))*2*CalcMat._Size,CalcMat._Size);
 		RetMat(Type,NewMat,CalcMat._Row,CalcMat._Col);
 		Type *LPtr=CalcMat._Value;
 		u8 ii,jj;
@@ -1423,6 +3167,7 @@ public://Functions
 	//Calculate Multiply
 	friend Mat<Type> operator*(Mat<Type> CalcMat, Type CalcValue)
 	{
+		MatProf(_PROF_SCALAR,((u32) sizeof(Type))*2*CalcMat._Size,CalcMat._Size);
 		RetMat(Type,NewMat,CalcMat._Row,CalcMat._Col);
 		Type *LPtr=CalcMat._Value;
 		u8 ii,jj;
@@ -1444,6 +3189,7 @@ public://Functions
 	//Calculate Devide
 	friend Mat<Type> operator/(Mat<Type> CalcMat, Type CalcValue)
 	{
+		MatProf(_PROF_SCALAR,((u32) sizeof(Type))*2*CalcMat._Size,CalcMat._Size);
 		RetMat(Type,NewMat,CalcMat._Row,CalcMat._Col);
 		Type *LPtr=CalcMat._Value;
 		u8 ii,jj;
@@ -1537,6 +3283,7 @@ public://Functions
 	//Calculate Plus
 	friend Mat<Type> operator+(Type CalcValue, Mat<Type> CalcMat)
 	{
+		MatProf(_PROF_SCALAR,((u32) sizeof(Type))*2*CalcMat._Size,CalcMat._Size);
 		RetMat(Type,NewMat,CalcMat._Row,CalcMat._Col);
 		Type *LPtr=CalcMat._Value;
 		u8 ii,jj;
@@ -1558,6 +3305,7 @@ public://Functions
 	//Calculate Minus
 	friend Mat<Type> operator-(Type CalcValue, Mat<Type> CalcMat)
 	{
+		MatProf(_PROF_SCALAR,((u32) sizeof(Type))*2*CalcMat._Size,CalcMat._Size);
 		RetMat(Type,NewMat,CalcMat._Row,CalcMat._Col);
 		Type *LPtr=CalcMat._Value;
 		u8 ii,jj;
@@ -1579,6 +3327,7 @@ public://Functions
 	//Calculate Multiply
 	friend Mat<Type> operator*(Type CalcValue, Mat<Type> CalcMat)
 	{
+		MatProf(_PROF_SCALAR,((u32) sizeof(Type))*2*CalcMat._Size,CalcMat._Size);
 		RetMat(Type,NewMat,CalcMat._Row,CalcMat._Col);
 		Type *LPtr=CalcMat._Value;
 		u8 ii,jj;
@@ -1607,6 +3356,7 @@ public://Functions
 	//Compare Bigger
 	friend Mat<bool> operator>(Mat<Type> CompareMatL,Mat<Type> CompareMatR)
 	{
+		MatProf(_PROF_COMPARE,(2*((u32) sizeof(Type))+1)*CompareMatL._Size,CompareMatL._Size);
 		RetMat(bool,NewMat,CompareMatL._Row,CompareMatR._Col);
 		Type *LPtr=CompareMatL._Value;
 		Type *RPtr=CompareMatR._Value;
@@ -1632,6 +3382,7 @@ public://Functions
 	//Compare Smaller
 	friend Mat<bool> operator<(Mat<Type> CompareMatL,Mat<Type> CompareMatR)
 	{
+		MatProf(_PROF_COMPARE,(2*((u32) sizeof(Type))+1)*CompareMatL._Size,CompareMatL._Size);
 		RetMat(bool,NewMat,CompareMatL._Row,CompareMatR._Col);
 		Type *LPtr=CompareMatL._Value;
 		Type *RPtr=CompareMatR._Value;
@@ -1656,6 +3407,7 @@ public://Functions
 	//Compare Equal
 	friend Mat<bool> operator==(Mat<Type> CompareMatL,Mat<Type> CompareMatR)
 	{
+		MatProf(_PROF_COMPARE,(2*((u32) sizeof(Type))+1)*CompareMatL._Size,CompareMatL._Size);
 		RetMat(bool,NewMat,CompareMatL._Row,CompareMatR._Col);
 		Type *LPtr=CompareMatL._Value;
 		Type *RPtr=CompareMatR._Value;
@@ -1680,6 +3432,7 @@ public://Functions
 	//Compare Inequal
 	friend Mat<bool> operator!=(Mat<Type> CompareMatL,Mat<Type> CompareMatR)
 	{
+		MatProf(_PROF_COMPARE,(2*((u32) sizeof(Type))+1)*CompareMatL._Size,CompareMatL._Size);
 		RetMat(bool,NewMat,CompareMatL._Row,CompareMatR._Col);
 		Type *LPtr=CompareMatL._Value;
 		Type *RPtr=CompareMatR._Value;
@@ -1704,6 +3457,7 @@ public://Functions
 	//Compare No Smaller
 	friend Mat<bool> operator>=(Mat<Type> CompareMatL,Mat<Type> CompareMatR)
 	{
+		MatProf(_PROF_COMPARE,(2*((u32) sizeof(Type))+1)*CompareMatL._Size,CompareMatL._Size);
 		RetMat(bool,NewMat,CompareMatL._Row,CompareMatR._Col);
 		Type *LPtr=CompareMatL._Value;
 		Type *RPtr=CompareMatR._Value;
@@ -1728,6 +3482,7 @@ public://Functions
 	//Compare No Bigger
 	friend Mat<bool> operator<=(Mat<Type> CompareMatL,Mat<Type> CompareMatR)
 	{
+		MatProf(_PROF_COMPARE,(2*((u32) sizeof(Type))+1)*CompareMatL._Size,CompareMatL._Size);
 		RetMat(bool,NewMat,CompareMatL._Row,CompareMatR._Col);
 		Type *LPtr=CompareMatL._Value;
 		Type *RPtr=CompareMatR._Value;
@@ -0,0 +1,688 @@
+/*
+*File Name: MiniMatBand.hpp
+*File Creation Date: October 18th 2026
+*File Final Revised Date: October 18th 2026
+*Author: Jiamin Wang
+*Description: Banded and Tridiagonal Matrix of MiniMat
+*/
+
+/*
+*Note:
+*BandMat and TriMat use u16 dimensions, so they are not limited to 255 rows like Mat.
+*BandMat stores row by row only the band of each row (2*KL+KU+1 elements, the extra KL for pivoting fill-in).
+*BandMat LU factorization uses partial pivoting and costs O(N*KL*(KL+KU)), solve costs O(N*(2*KL+KU)).
+*TriMat is the fast path for tridiagonal systems (Thomas algorithm, O(N)), it does not pivot so the matrix should be diagonally dominant.
+*Right hand sides are plain arrays of N elements and are solved in place; Mat can be used when N<=255.
+*BandMat Factor() works in place, so the original matrix is lost after factorization (Mult is only meaningful before)
+*	and single value edits are ignored until the matrix is reloaded with operator=; TriMat keeps its coefficients and refactors.
+*/
+
+#ifndef MINIMATBAND_HPP_
+#define MINIMATBAND_HPP_
+
+#include "MiniMat.hpp"
+
+//Define a fixed band matrix
+#define DefBand(TYPE,NAME,ROW,KL,KU) \
+	TYPE MACON(NAME,DEFBAND)[((u32) ROW)*(2*((u32) KL)+((u32) KU)+1)];\
+	u16 MACON(NAME,DEFPIVOT)[((u32) ROW)];\
+	BandMat<TYPE> NAME( (u16) ROW , (u16) KL , (u16) KU , ((TYPE *) &(MACON(NAME,DEFBAND)[0])) , ((u16 *) &(MACON(NAME,DEFPIVOT)[0])) );
+
+//Define a fixed tridiagonal matrix
+#define DefTri(TYPE,NAME,ROW) \
+	TYPE MACON(NAME,DEFTRI)[((u32) ROW)*5];\
+	TriMat<TYPE> NAME( (u16) ROW , ((TYPE *) &(MACON(NAME,DEFTRI)[0])) );
+
+//Define a temporary band/tridiagonal matrix on heap (For large systems)
+#if _HEAPSCOPE
+	#define TmpBand(TYPE,NAME,ROW,KL,KU) \
+			TYPE *MACON(NAME,TMPBAND)=(TYPE *) malloc(sizeof(TYPE)*((u32) ROW)*(2*((u32) KL)+((u32) KU)+1));\
+			u16 *MACON(NAME,TMPPIVOT)=(u16 *) malloc(sizeof(u16)*((u32) ROW));\
+			MiniMat_HeapScope._HeapPlus(sizeof(TYPE)*((u32) ROW)*(2*((u32) KL)+((u32) KU)+1)+sizeof(u16)*((u32) ROW));\
+			BandMat<TYPE> NAME( (u16) ROW , (u16) KL , (u16) KU , MACON(NAME,TMPBAND) , MACON(NAME,TMPPIVOT) );\
+			NAME.SetTemp();
+
+	#define TmpTri(TYPE,NAME,ROW) \
+			TYPE *MACON(NAME,TMPTRI)=(TYPE *) malloc(sizeof(TYPE)*((u32) ROW)*5);\
+			MiniMat_HeapScope._HeapPlus(sizeof(TYPE)*((u32) ROW)*5);\
+			TriMat<TYPE> NAME( (u16) ROW , MACON(NAME,TMPTRI) );\
+			NAME.SetTemp();
+#else
+	#define TmpBand(TYPE,NAME,ROW,KL,KU) \
+			TYPE *MACON(NAME,TMPBAND)=(TYPE *) malloc(sizeof(TYPE)*((u32) ROW)*(2*((u32) KL)+((u32) KU)+1));\
+			u16 *MACON(NAME,TMPPIVOT)=(u16 *) malloc(sizeof(u16)*((u32) ROW));\
+			BandMat<TYPE> NAME( (u16) ROW , (u16) KL , (u16) KU , MACON(NAME,TMPBAND) , MACON(NAME,TMPPIVOT) );\
+			NAME.SetTemp();
+
+	#define TmpTri(TYPE,NAME,ROW) \
+			TYPE *MACON(NAME,TMPTRI)=(TYPE *) malloc(sizeof(TYPE)*((u32) ROW)*5);\
+			TriMat<TYPE> NAME( (u16) ROW , MACON(NAME,TMPTRI) );\
+			NAME.SetTemp();
+#endif
+
+
+
+template <class Type>
+
+class BandMat
+{
+
+protected://Variables (None of the variables can be directly accessed)
+
+	bool _IsFactored;//Indicate LU Factorized Status
+	bool _IsTemp;//Indicate Temperorary Status
+
+	Type *_Value;//Root Pointer (Row by Row Band Storage)
+	u16 *_Pivot;//Pivot Row of Each Elimination Step
+	u16 _Row;//Number of Rows (Same as Number of Columns)
+	u16 _KL;//Number of Sub Diagonals
+	u16 _KU;//Number of Super Diagonals
+	u16 _Width;//Stored Elements of Each Row (2*KL+KU+1)
+
+	//Locate Element (Zero Based, Must be Inside the Stored Band)
+	Type * _Loc(u16 Row, u16 Col)
+	{
+		return _Value+((u32) Row)*_Width+(Col+_KL-Row);
+	}
+
+
+
+public://Functions
+
+	//////Constrcutors & Destructors
+
+	//Global Variable Constructor
+	explicit BandMat(u16 Row, u16 KL, u16 KU, Type *Value, u16 *Pivot):
+	_IsFactored(0),_IsTemp(0),
+	_Value(Value),_Pivot(Pivot),_Row(Row),_KL(KL),_KU(KU),_Width(2*KL+KU+1)
+	{
+		*this=0;
+	};
+
+	//Variable Destructor (Designed for Regional Variable)
+	~BandMat(){};
+
+	//////End of Constrcutors & Destructors
+
+
+
+	//////Content Operation (These Functions Work on Itself)
+
+	//Set Temp Status
+	BandMat<Type> & SetTemp()
+	{
+		_IsTemp=1;
+		return *this;
+	}
+
+	//Clean Temp
+	void CleanTmp()
+	{
+		if(_IsTemp)
+		{
+#if _HEAPSCOPE
+			MiniMat_HeapScope._HeapMinus(((u32)sizeof(Type))*((u32)_Row)*_Width+((u32)sizeof(u16))*((u32)_Row));
+#endif
+			free(_Value);
+			free(_Pivot);
+			_Value=NULL;
+			_Pivot=NULL;
+		}
+		return;
+	}
+
+	//Set All Elements inside the Band to Same Value (Clear Factorization)
+	BandMat<Type> & operator=(Type EqualValue)
+	{
+		Type *_Ptr1=_Value;
+		u32 ii;
+		u16 jj;
+		for(ii=0;ii<_Row;ii++)
+		{
+			for(jj=0;jj<_Width;jj++)
+			{
+				*_Ptr1=((jj<=_KL+_KU)&&(jj+ii>=_KL)&&(jj+ii<_Row+_KL))?EqualValue:0;
+				_Ptr1++;
+			}
+		}
+		_IsFactored=0;
+		return *this;
+	}
+
+	//Copy Band Part from a Matrix (This will destroy Input Mat if is Temp Mat)
+	BandMat<Type> & operator=(Mat<Type> EqualMat)
+	{
+		*this=0;
+		u16 ii,jj,Low,High;
+		for(ii=0;ii<_Row;ii++)
+		{
+			Low=(ii>_KL)?(ii-_KL):0;
+			High=(ii+_KU<_Row)?(ii+_KU):(_Row-1);
+			for(jj=Low;jj<=High;jj++)
+			{
+				*_Loc(ii,jj)=*(EqualMat.Pt()+ii*EqualMat.Co()+jj);
+			}
+		}
+
+		EqualMat.CleanRet();
+
+		return *this;
+	}
+
+	//Insert Single Value (Must be Inside the Band, Ignored after Factor since the Band Holds LU, Reload with operator= First)
+	BandMat<Type> & operator()(u16 Row, u16 Col, Type Value)
+	{
+		if(!_IsFactored)
+		{
+			*_Loc(Row-1,Col-1)=Value;
+		}
+		return *this;
+	}
+
+	//Insert Whole Diagonal with Same Value (Offset 0 for Main Diagonal, Positive for Super, Negative for Sub, Ignored after Factor)
+	BandMat<Type> & SetDiag(s16 Offset, Type Value)
+	{
+		u16 ii;
+		if(_IsFactored)
+		{
+			return *this;
+		}
+		for(ii=0;ii<_Row;ii++)
+		{
+			if((((s32) ii)+Offset>=0)&&(((s32) ii)+Offset<_Row))
+			{
+				*_Loc(ii,(u16)(ii+Offset))=Value;
+			}
+		}
+		return *this;
+	}
+
+	//Print the Matrix on Console
+#if !_MICROCHIP
+	void Print()
+	{
+		cout<<endl;
+		u16 ii,jj;
+		for(ii=1;ii<=_Row;ii++)
+		{
+			for(jj=1;jj<=_Row;jj++)
+			{
+				cout<<Val(ii,jj)<<"\t";
+			}
+			cout<<endl;
+		}
+	}
+#endif
+
+	//////End of Content operation
+
+
+
+	//////Self Interaction (These functions, if correctly used, generates new things)
+
+	//FeedBack RowNum
+	u16 Ro()
+	{
+		return _Row;
+	}
+
+	//FeedBack Number of Sub Diagonals
+	u16 KL()
+	{
+		return _KL;
+	}
+
+	//FeedBack Number of Super Diagonals
+	u16 KU()
+	{
+		return _KU;
+	}
+
+	//FeedBack Memory Space
+	u32 Sp()
+	{
+		return ((u32)_Row)*_Width*sizeof(Type)+((u32)_Row)*sizeof(u16);
+	}
+
+	//FeedBack Factorization Status
+	bool Factored()
+	{
+		return _IsFactored;
+	}
+
+	//Extract Single Value (Return 0 if Outside the Band)
+	Type Val(u16 Row, u16 Col)
+	{
+		if((Col+_KL<Row)||(Col>Row+_KU+_KL))
+		{
+			return 0;
+		}
+		return *_Loc(Row-1,Col-1);
+	}
+
+	//Calculate Matrix Vector Multiply Out=A*In (Only Before Factorization)
+	void Mult(Type *In, Type *Out)
+	{
+		u16 ii,jj,Low,High;
+		Type MultSum;
+		Type *_Ptr1;
+		for(ii=0;ii<_Row;ii++)
+		{
+			Low=(ii>_KL)?(ii-_KL):0;
+			High=(ii+_KU<_Row)?(ii+_KU):(_Row-1);
+			_Ptr1=_Loc(ii,Low);
+			MultSum=0;
+			for(jj=Low;jj<=High;jj++)
+			{
+				MultSum+=(*_Ptr1)*(*(In+jj));
+				_Ptr1++;
+			}
+			*(Out+ii)=MultSum;
+		}
+		return;
+	}
+
+	//Calculate LU Factorization with Partial Pivoting in Place (Return 0 if Singular)
+	bool Factor()
+	{
+		u16 ii,jj,kk,PivRow,Last,Reach;
+		Type PivVal,Mediate,Factor;
+		Type *_Ptr1,*_Ptr2;
+
+		//Zero the KL Fill Elements (A Previous Factorization Wrote into Them)
+		for(ii=0;ii<_Row;ii++)
+		{
+			Reach=(ii+_KL+_KU<_Row)?(ii+_KL+_KU):(_Row-1);
+			for(jj=ii+_KU+1;jj<=Reach;jj++)
+			{
+				*_Loc(ii,jj)=0;
+			}
+		}
+
+		for(kk=0;kk<_Row;kk++)
+		{
+			Last=(kk+_KL<_Row)?(kk+_KL):(_Row-1);
+			Reach=(kk+_KL+_KU<_Row)?(kk+_KL+_KU):(_Row-1);
+
+			PivRow=kk;
+			PivVal=fabs(*_Loc(kk,kk));
+			for(ii=kk+1;ii<=Last;ii++)
+			{
+				if(fabs(*_Loc(ii,kk))>PivVal)
+				{
+					PivVal=fabs(*_Loc(ii,kk));
+					PivRow=ii;
+				}
+			}
+			*(_Pivot+kk)=PivRow;
+
+			if(PivVal==0)
+			{
+				return 0;
+			}
+
+			if(PivRow!=kk)
+			{
+				for(jj=kk;jj<=Reach;jj++)
+				{
+					Mediate=*_Loc(kk,jj);
+					*_Loc(kk,jj)=*_Loc(PivRow,jj);
+					*_Loc(PivRow,jj)=Mediate;
+				}
+			}
+
+			PivVal=*_Loc(kk,kk);
+			for(ii=kk+1;ii<=Last;ii++)
+			{
+				_Ptr1=_Loc(ii,kk);
+				Factor=(*_Ptr1)/PivVal;
+				*_Ptr1=Factor;
+				if(Factor!=0)
+				{
+					_Ptr1++;
+					_Ptr2=_Loc(kk,kk+1);
+					for(jj=kk+1;jj<=Reach;jj++)
+					{
+						*_Ptr1-=Factor*(*_Ptr2);
+						_Ptr1++;
+						_Ptr2++;
+					}
+				}
+			}
+		}
+
+		_IsFactored=1;
+		return 1;
+	}
+
+	//Solve A*x=b in Place with Stride between Elements (Factorize First if Not Yet, Return 0 if Singular)
+	bool Solve(Type *Rhs, u16 Stride=1)
+	{
+		if((!_IsFactored)&&(!Factor()))
+		{
+			return 0;
+		}
+
+		u16 ii,jj,kk,Last,Reach;
+		Type Mediate,MultSum;
+		Type *_Ptr1;
+		for(kk=0;kk<_Row;kk++)
+		{
+			if(*(_Pivot+kk)!=kk)
+			{
+				Mediate=*(Rhs+((u32) kk)*Stride);
+				*(Rhs+((u32) kk)*Stride)=*(Rhs+((u32) *(_Pivot+kk))*Stride);
+				*(Rhs+((u32) *(_Pivot+kk))*Stride)=Mediate;
+			}
+			Mediate=*(Rhs+((u32) kk)*Stride);
+			if(Mediate!=0)
+			{
+				Last=(kk+_KL<_Row)?(kk+_KL):(_Row-1);
+				for(ii=kk+1;ii<=Last;ii++)
+				{
+					*(Rhs+((u32) ii)*Stride)-=(*_Loc(ii,kk))*Mediate;
+				}
+			}
+		}
+
+		for(kk=_Row;kk>0;kk--)
+		{
+			ii=kk-1;
+			Reach=(ii+_KL+_KU<_Row)?(ii+_KL+_KU):(_Row-1);
+			MultSum=*(Rhs+((u32) ii)*Stride);
+			_Ptr1=_Loc(ii,ii)+1;
+			for(jj=ii+1;jj<=Reach;jj++)
+			{
+				MultSum-=(*_Ptr1)*(*(Rhs+((u32) jj)*Stride));
+				_Ptr1++;
+			}
+			*(Rhs+((u32) ii)*Stride)=MultSum/(*_Loc(ii,ii));
+		}
+
+		return 1;
+	}
+
+	//Solve A*X=B for Every Column of B (N<=255, 0s if Singular and Factored() Stays 0, This will destroy Input Mat if is Temp Mat)
+	friend Mat<Type> Solve(BandMat<Type> &CalcBand, Mat<Type> CalcMat)
+	{
+		RetMat(Type,NewMat,CalcMat.Ro(),CalcMat.Co());
+		NewMat=CalcMat;
+
+		if((!CalcBand.Factored())&&(!CalcBand.Factor()))
+		{
+			NewMat=0;
+			return NewMat;
+		}
+
+		u8 jj;
+		for(jj=0;jj<NewMat.Co();jj++)
+		{
+			CalcBand.Solve(NewMat.Pt()+jj,NewMat.Co());
+		}
+
+		return NewMat;
+	}
+
+	//////End of Self Interaction
+
+};
+
+
+
+template <class Type>
+
+class TriMat
+{
+
+protected://Variables (None of the variables can be directly accessed)
+
+	bool _IsFactored;//Indicate Factorized Status
+	bool _IsTemp;//Indicate Temperorary Status
+
+	Type *_Value;//Root Pointer
+	Type *_Sub;//Sub Diagonal (First Element Unused)
+	Type *_Diag;//Main Diagonal
+	Type *_Sup;//Super Diagonal (Last Element Unused)
+	Type *_Fwd;//Modified Super Diagonal of Thomas Algorithm
+	Type *_InvPiv;//Inverse of Modified Diagonal of Thomas Algorithm
+	u16 _Row;//Number of Rows (Same as Number of Columns)
+
+
+
+public://Functions
+
+	//////Constrcutors & Destructors
+
+	//Global Variable Constructor (Value Holds 5*Row Elements)
+	explicit TriMat(u16 Row, Type *Value):
+	_IsFactored(0),_IsTemp(0),
+	_Value(Value),
+	_Sub(Value),_Diag(Value+Row),_Sup(Value+2*((u32) Row)),
+	_Fwd(Value+3*((u32) Row)),_InvPiv(Value+4*((u32) Row)),
+	_Row(Row)
+	{
+		Set(0,0,0);
+	};
+
+	//Variable Destructor (Designed for Regional Variable)
+	~TriMat(){};
+
+	//////End of Constrcutors & Destructors
+
+
+
+	//////Content Operation (These Functions Work on Itself)
+
+	//Set Temp Status
+	TriMat<Type> & SetTemp()
+	{
+		_IsTemp=1;
+		return *this;
+	}
+
+	//Clean Temp
+	void CleanTmp()
+	{
+		if(_IsTemp)
+		{
+#if _HEAPSCOPE
+			MiniMat_HeapScope._HeapMinus(((u32)sizeof(Type))*((u32)_Row)*5);
+#endif
+			free(_Value);
+			_Value=NULL;
+		}
+		return;
+	}
+
+	//Set Constant Coefficients (Clear Factorization)
+	TriMat<Type> & Set(Type SubValue, Type DiagValue, Type SupValue)
+	{
+		u16 ii;
+		for(ii=0;ii<_Row;ii++)
+		{
+			*(_Sub+ii)=(ii>0)?SubValue:0;
+			*(_Diag+ii)=DiagValue;
+			*(_Sup+ii)=(ii+1<_Row)?SupValue:0;
+		}
+		_IsFactored=0;
+		return *this;
+	}
+
+	//Insert Single Value (Must be on the Three Diagonals, Clear Factorization)
+	TriMat<Type> & operator()(u16 Row, u16 Col, Type Value)
+	{
+		if(Col==Row)
+		{
+			*(_Diag+Row-1)=Value;
+		}
+		else if(Col+1==Row)
+		{
+			*(_Sub+Row-1)=Value;
+		}
+		else if(Col==Row+1)
+		{
+			*(_Sup+Row-1)=Value;
+		}
+		_IsFactored=0;
+		return *this;
+	}
+
+	//Print the Matrix on Console
+#if !_MICROCHIP
+	void Print()
+	{
+		cout<<endl;
+		u16 ii,jj;
+		for(ii=1;ii<=_Row;ii++)
+		{
+			for(jj=1;jj<=_Row;jj++)
+			{
+				cout<<Val(ii,jj)<<"\t";
+			}
+			cout<<endl;
+		}
+	}
+#endif
+
+	//////End of Content operation
+
+
+
+	//////Self Interaction (These functions, if correctly used, generates new things)
+
+	//FeedBack RowNum
+	u16 Ro()
+	{
+		return _Row;
+	}
+
+	//FeedBack Memory Space
+	u32 Sp()
+	{
+		return ((u32)_Row)*5*sizeof(Type);
+	}
+
+	//FeedBack Factorization Status
+	bool Factored()
+	{
+		return _IsFactored;
+	}
+
+	//Extract Single Value (Return 0 if Outside the Three Diagonals)
+	Type Val(u16 Row, u16 Col)
+	{
+		if(Col==Row)
+		{
+			return *(_Diag+Row-1);
+		}
+		else if(Col+1==Row)
+		{
+			return *(_Sub+Row-1);
+		}
+		else if(Col==Row+1)
+		{
+			return *(_Sup+Row-1);
+		}
+		return 0;
+	}
+
+	//Calculate Matrix Vector Multiply Out=A*In
+	void Mult(Type *In, Type *Out)
+	{
+		u16 ii;
+		for(ii=0;ii<_Row;ii++)
+		{
+			*(Out+ii)=(*(_Diag+ii))*(*(In+ii));
+			if(ii>0)
+			{
+				*(Out+ii)+=(*(_Sub+ii))*(*(In+ii-1));
+			}
+			if(ii+1<_Row)
+			{
+				*(Out+ii)+=(*(_Sup+ii))*(*(In+ii+1));
+			}
+		}
+		return;
+	}
+
+	//Calculate Thomas Factorization (Original Coefficients are Kept, Return 0 if a Zero Pivot Appears)
+	bool Factor()
+	{
+		Type Piv;
+		u16 ii;
+		for(ii=0;ii<_Row;ii++)
+		{
+			Piv=*(_Diag+ii);
+			if(ii>0)
+			{
+				Piv-=(*(_Sub+ii))*(*(_Fwd+ii-1));
+			}
+			if(Piv==0)
+			{
+				return 0;
+			}
+			*(_InvPiv+ii)=1/Piv;
+			*(_Fwd+ii)=(*(_Sup+ii))*(*(_InvPiv+ii));
+		}
+
+		_IsFactored=1;
+		return 1;
+	}
+
+	//Solve A*x=b in Place with Stride between Elements (Factorize First if Not Yet, Return 0 if Singular)
+	bool Solve(Type *Rhs, u16 Stride=1)
+	{
+		if((!_IsFactored)&&(!Factor()))
+		{
+			return 0;
+		}
+
+		u16 ii;
+		Type *_Ptr1=Rhs;
+		Type Prev=0;
+		for(ii=0;ii<_Row;ii++)
+		{
+			Prev=((*_Ptr1)-(*(_Sub+ii))*Prev)*(*(_InvPiv+ii));
+			*_Ptr1=Prev;
+			_Ptr1+=Stride;
+		}
+
+		_Ptr1-=Stride;
+		Prev=*_Ptr1;
+		for(ii=_Row-1;ii>0;ii--)
+		{
+			_Ptr1-=Stride;
+			Prev=(*_Ptr1)-(*(_Fwd+ii-1))*Prev;
+			*_Ptr1=Prev;
+		}
+
+		return 1;
+	}
+
+	//Solve A*X=B for Every Column of B (N<=255, 0s if Singular and Factored() Stays 0, This will destroy Input Mat if is Temp Mat)
+	friend Mat<Type> Solve(TriMat<Type> &CalcTri, Mat<Type> CalcMat)
+	{
+		RetMat(Type,NewMat,CalcMat.Ro(),CalcMat.Co());
+		NewMat=CalcMat;
+
+		if((!CalcTri.Factored())&&(!CalcTri.Factor()))
+		{
+			NewMat=0;
+			return NewMat;
+		}
+
+		u8 jj;
+		for(jj=0;jj<NewMat.Co();jj++)
+		{
+			CalcTri.Solve(NewMat.Pt()+jj,NewMat.Co());
+		}
+
+		return NewMat;
+	}
+
+	//////End of Self Interaction
+
+};
+
+
+#endif
@@ -0,0 +1,523 @@
+/*
+*File Name: MiniMatBatch.hpp
+*File Creation Date: October 18th 2026
+*File Final Revised Date: October 18th 2026
+*Author: Jiamin Wang
+*Description: Batched Small Matrix Operations of MiniMat
+*/
+
+/*
+*Note:
+*A batch is one buffer holding Num matrices of the same shape back to back, each in the row-major layout of Mat,
+*	e.g. double Pose[1000][16] is a batch of 1000 4*4 matrices. BatchAt(Buffer,Row,Col,Index) views one of them as a Mat.
+*BatchMult, BatchTrans, BatchDet, BatchInv and BatchSolve run over the whole batch without creating temp Mats;
+*	the outputs are written to a caller buffer and the inputs are never modified (outputs must not alias inputs).
+*3*3, 4*4 and 6*6 shapes are dispatched with constant sizes, so the compiler fully unrolls the kernels and vectorizes them
+*	within each matrix. The loops run one matrix at a time, there is no SIMD across matrices here: for that, load the batch
+*	into a SoAMat (SoAMat::FromBatch of MiniMatSoA.hpp), whose multiply kernels run every instruction over 4/8/16 matrices
+*	(SoAMat also has Det, Inv and Solve without pivoting for 3*3 and 4*4, the pivoted ones here are more robust).
+*Det, Inv and Solve use Gaussian elimination with partial pivoting (O(N^3)) and are meant for floating point types.
+*	Their work space is on the stack up to _MATBATCH_MAX rows, larger matrices use one heap buffer and run on one thread.
+*Same as Inv of Mat, a matrix whose determinant is within 1e-5 of 0 is singular; BatchInv and BatchSolve write 0s for it
+*	and return the number of singular matrices.
+*Compiled with OpenMP (-fopenmp), batches of at least _MATBATCH_PAR matrices are split across cores.
+*/
+
+#ifndef MINIMATBATCH_HPP_
+#define MINIMATBATCH_HPP_
+
+#include "MiniMat.hpp"
+
+#ifndef _MATBATCH_MAX
+	#define _MATBATCH_MAX 16//Largest Row with Elimination Work on the Stack (2*_MATBATCH_MAX^2 Elements)
+#endif
+
+#ifndef _MATBATCH_PAR
+	#define _MATBATCH_PAR 4096//Smallest Batch Split across Threads
+#endif
+
+//Loop over the matrices of a batch (ii and the batch size Num are declared by the caller, parallel with OpenMP)
+#ifdef _OPENMP
+	#define _MATBATCH_FOR \
+			_Pragma("omp parallel for if(Num>=_MATBATCH_PAR) schedule(static)") \
+			for(ii=0;ii<((s32) Num);ii++)
+
+	//Same Loop Summing the Singular Count of the caller
+	#define _MATBATCH_COUNT \
+			_Pragma("omp parallel for if(Num>=_MATBATCH_PAR) schedule(static) reduction(+:Singular)") \
+			for(ii=0;ii<((s32) Num);ii++)
+#else
+	#define _MATBATCH_FOR \
+			for(ii=0;ii<((s32) Num);ii++)
+
+	#define _MATBATCH_COUNT \
+			for(ii=0;ii<((s32) Num);ii++)
+#endif
+
+
+
+//Batched Kernels of One Matrix (Inline, Constant Sizes from the Callers are Propagated)
+template <class Type>
+
+class MiniMat_BatchKernel
+{
+public:
+	//Multiply Out=L*R
+	static inline void Mult(Type *Out, const Type *InL, const Type *InR, u8 Row, u8 Inner, u8 Col)
+	{
+		typename MiniMat_Acc<Type>::Acc MultSum;
+		const Type *LPtr,*RPtr;
+		u8 ii,jj,kk;
+
+		for(ii=0;ii<Row;ii++)
+		{
+			for(jj=0;jj<Col;jj++)
+			{
+				MultSum=MiniMat_Acc<Type>::Zero();
+				LPtr=InL+((u16) ii)*Inner;
+				RPtr=InR+jj;
+				for(kk=0;kk<Inner;kk++)
+				{
+					MiniMat_Acc<Type>::Mac(MultSum,*LPtr,*RPtr);
+					LPtr++;
+					RPtr+=Col;
+				}
+				*Out=MiniMat_Acc<Type>::Out(MultSum);
+				Out++;
+			}
+		}
+	}
+
+	//Transpose
+	static inline void Trans(Type *Out, const Type *In, u8 Row, u8 Col)
+	{
+		u8 ii,jj;
+
+		for(ii=0;ii<Row;ii++)
+		{
+			for(jj=0;jj<Col;jj++)
+			{
+				*(Out+((u16) jj)*Row+ii)=*In;
+				In++;
+			}
+		}
+	}
+
+	//Determinant (Closed Form for 2*2 and 3*3, Same as Det of Mat, Work Holds Row*Row)
+	static inline Type Det(const Type *In, u8 Row, Type *Work)
+	{
+		if(Row==1)
+		{
+			return *In;
+		}
+		if(Row==2)
+		{
+			return (*In)*(*(In+3))-(*(In+1))*(*(In+2));
+		}
+		if(Row==3)
+		{
+			Type SumVal;
+			SumVal=(*In)*(*(In+4))*(*(In+8));
+			SumVal+=(*(In+1))*(*(In+5))*(*(In+6));
+			SumVal+=(*(In+2))*(*(In+3))*(*(In+7));
+			SumVal-=(*In)*(*(In+7))*(*(In+5));
+			SumVal-=(*(In+1))*(*(In+3))*(*(In+8));
+			SumVal-=(*(In+2))*(*(In+6))*(*(In+4));
+			return SumVal;
+		}
+
+		u16 ii;
+		for(ii=0;ii<((u16) Row)*Row;ii++)
+		{
+			*(Work+ii)=*(In+ii);
+		}
+		return _Elim(Work,Row,Row);
+	}
+
+	//Inverse (0s and False if Singular, Work Holds 2*Row*Row)
+	static inline bool Inv(Type *Out, const Type *In, u8 Row, Type *Work)
+	{
+		u8 ii,jj;
+		u16 Width=2*((u16) Row);
+
+		for(ii=0;ii<Row;ii++)
+		{
+			for(jj=0;jj<Row;jj++)
+			{
+				*(Work+((u16) ii)*Width+jj)=*(In+((u16) ii)*Row+jj);
+				*(Work+((u16) ii)*Width+Row+jj)=(ii==jj)?1:0;
+			}
+		}
+		return _Back(Out,Work,Row,Row);
+	}
+
+	//Solve A*X=B (B has Col Columns, 0s and False if Singular, Work Holds Row*(Row+Col))
+	static inline bool Solve(Type *Out, const Type *InA, const Type *InB, u8 Row, u8 Col, Type *Work)
+	{
+		u8 ii,jj;
+		u16 Width=((u16) Row)+Col;
+
+		for(ii=0;ii<Row;ii++)
+		{
+			for(jj=0;jj<Row;jj++)
+			{
+				*(Work+((u16) ii)*Width+jj)=*(InA+((u16) ii)*Row+jj);
+			}
+			for(jj=0;jj<Col;jj++)
+			{
+				*(Work+((u16) ii)*Width+Row+jj)=*(InB+((u16) ii)*Col+jj);
+			}
+		}
+		return _Back(Out,Work,Row,Col);
+	}
+
+	//Forward Elimination with Partial Pivoting on [A|B] (Row*Width), Return Determinant of A
+	static inline Type _Elim(Type *Work, u8 Row, u16 Width)
+	{
+		Type DetVal=1;
+		Type Pivot,Factor,Swap;
+		Type *KRow,*IRow;
+		u16 jj;
+		u8 ii,kk,Best;
+
+		for(kk=0;kk<Row;kk++)
+		{
+			KRow=Work+((u16) kk)*Width;
+			Best=kk;
+			for(ii=kk+1;ii<Row;ii++)
+			{
+				if(fabs(*(Work+((u16) ii)*Width+kk))>fabs(*(Work+((u16) Best)*Width+kk)))
+				{
+					Best=ii;
+				}
+			}
+			if(Best!=kk)
+			{
+				IRow=Work+((u16) Best)*Width;
+				for(jj=kk;jj<Width;jj++)
+				{
+					Swap=*(KRow+jj);
+					*(KRow+jj)=*(IRow+jj);
+					*(IRow+jj)=Swap;
+				}
+				DetVal=-DetVal;
+			}
+			Pivot=*(KRow+kk);
+			DetVal*=Pivot;
+			if(Pivot==0)
+			{
+				return 0;
+			}
+			for(ii=kk+1;ii<Row;ii++)
+			{
+				IRow=Work+((u16) ii)*Width;
+				Factor=(*(IRow+kk))/Pivot;
+				for(jj=kk+1;jj<Width;jj++)
+				{
+					*(IRow+jj)-=Factor*(*(KRow+jj));
+				}
+				*(IRow+kk)=0;
+			}
+		}
+		return DetVal;
+	}
+
+	//Eliminate [A|B] and Back Substitute into Out (Row*Col)
+	static inline bool _Back(Type *Out, Type *Work, u8 Row, u8 Col)
+	{
+		u16 Width=((u16) Row)+Col;
+		Type SumVal;
+		u8 ii,jj,kk;
+
+		if(fabs(_Elim(Work,Row,Width))<=1e-5)
+		{
+			for(ii=0;ii<Row;ii++)
+			{
+				for(jj=0;jj<Col;jj++)
+				{
+					*(Out+((u16) ii)*Col+jj)=0;
+				}
+			}
+			return false;
+		}
+		for(jj=0;jj<Col;jj++)
+		{
+			for(ii=Row;ii>0;ii--)
+			{
+				SumVal=*(Work+((u16) (ii-1))*Width+Row+jj);
+				for(kk=ii;kk<Row;kk++)
+				{
+					SumVal-=(*(Work+((u16) (ii-1))*Width+kk))*(*(Out+((u16) kk)*Col+jj));
+				}
+				*(Out+((u16) (ii-1))*Col+jj)=SumVal/(*(Work+((u16) (ii-1))*Width+ii-1));
+			}
+		}
+		return true;
+	}
+};
+
+
+
+//View One Matrix of a Batch as Mat
+template <class Type>
+
+Mat<Type> BatchAt(Type *Buffer, u8 Row, u8 Col, u32 Index)
+{
+	return Mat<Type>(Row,Col,Buffer+Index*(((u32) Row)*Col));
+}
+
+//Multiply Out[n]=L[n]*R[n] for Each Matrix of the Batches
+template <class Type>
+
+void BatchMult(Type *Out, const Type *InL, const Type *InR, u8 Row, u8 Inner, u8 Col, u32 Num)
+{
+	u32 LStep=((u32) Row)*Inner;
+	u32 RStep=((u32) Inner)*Col;
+	u32 OStep=((u32) Row)*Col;
+	s32 ii;
+
+	if((Row==Inner)&&(Inner==Col)&&(Row==3))
+	{
+		_MATBATCH_FOR
+		{
+			MiniMat_BatchKernel<Type>::Mult(Out+ii*9,InL+ii*9,InR+ii*9,3,3,3);
+		}
+	}
+	else if((Row==Inner)&&(Inner==Col)&&(Row==4))
+	{
+		_MATBATCH_FOR
+		{
+			MiniMat_BatchKernel<Type>::Mult(Out+ii*16,InL+ii*16,InR+ii*16,4,4,4);
+		}
+	}
+	else if((Row==Inner)&&(Inner==Col)&&(Row==6))
+	{
+		_MATBATCH_FOR
+		{
+			MiniMat_BatchKernel<Type>::Mult(Out+ii*36,InL+ii*36,InR+ii*36,6,6,6);
+		}
+	}
+	else if((Row==Inner)&&(Row==4)&&(Col==1))
+	{
+		_MATBATCH_FOR
+		{
+			MiniMat_BatchKernel<Type>::Mult(Out+ii*4,InL+ii*16,InR+ii*4,4,4,1);
+		}
+	}
+	else
+	{
+		_MATBATCH_FOR
+		{
+			MiniMat_BatchKernel<Type>::Mult(Out+ii*OStep,InL+ii*LStep,InR+ii*RStep,Row,Inner,Col);
+		}
+	}
+	return;
+}
+
+//Transpose Each Matrix of the Batch (Out is Col*Row per Matrix)
+template <class Type>
+
+void BatchTrans(Type *Out, const Type *In, u8 Row, u8 Col, u32 Num)
+{
+	u32 Step=((u32) Row)*Col;
+	s32 ii;
+
+	if((Row==Col)&&(Row==3))
+	{
+		_MATBATCH_FOR
+		{
+			MiniMat_BatchKernel<Type>::Trans(Out+ii*9,In+ii*9,3,3);
+		}
+	}
+	else if((Row==Col)&&(Row==4))
+	{
+		_MATBATCH_FOR
+		{
+			MiniMat_BatchKernel<Type>::Trans(Out+ii*16,In+ii*16,4,4);
+		}
+	}
+	else
+	{
+		_MATBATCH_FOR
+		{
+			MiniMat_BatchKernel<Type>::Trans(Out+ii*Step,In+ii*Step,Row,Col);
+		}
+	}
+	return;
+}
+
+//Heap Work of Det, Inv and Solve for Rows above _MATBATCH_MAX
+template <class Type>
+
+Type *_BatchWorkPlus(u32 Num)
+{
+	Type *Work=(Type *) malloc(sizeof(Type)*Num);
+#if _HEAPSCOPE
+	MiniMat_HeapScope._HeapPlus(((u32) sizeof(Type))*Num);
+#endif
+	return Work;
+}
+
+template <class Type>
+
+void _BatchWorkMinus(Type *Work, u32 Num)
+{
+	free(Work);
+#if _HEAPSCOPE
+	MiniMat_HeapScope._HeapMinus(((u32) sizeof(Type))*Num);
+#endif
+}
+
+//Determinant of Each Square Matrix of the Batch (Out Holds Num Values)
+template <class Type>
+
+void BatchDet(Type *Out, const Type *In, u8 Row, u32 Num)
+{
+	u32 Step=((u32) Row)*Row;
+	s32 ii;
+
+	if(Row>_MATBATCH_MAX)
+	{
+		Type *Work=_BatchWorkPlus<Type>(Step);
+		for(ii=0;ii<((s32) Num);ii++)
+		{
+			*(Out+ii)=MiniMat_BatchKernel<Type>::Det(In+ii*Step,Row,Work);
+		}
+		_BatchWorkMinus(Work,Step);
+	}
+	else if(Row==4)
+	{
+		_MATBATCH_FOR
+		{
+			Type Work[16];
+			*(Out+ii)=MiniMat_BatchKernel<Type>::Det(In+ii*16,4,Work);
+		}
+	}
+	else if(Row==6)
+	{
+		_MATBATCH_FOR
+		{
+			Type Work[36];
+			*(Out+ii)=MiniMat_BatchKernel<Type>::Det(In+ii*36,6,Work);
+		}
+	}
+	else
+	{
+		_MATBATCH_FOR
+		{
+			Type Work[_MATBATCH_MAX*_MATBATCH_MAX];
+			*(Out+ii)=MiniMat_BatchKernel<Type>::Det(In+ii*Step,Row,Work);
+		}
+	}
+	return;
+}
+
+//Inverse of Each Square Matrix of the Batch (Return Number of Singular Matrices, which are Set to 0s)
+template <class Type>
+
+u32 BatchInv(Type *Out, const Type *In, u8 Row, u32 Num)
+{
+	u32 Step=((u32) Row)*Row;
+	u32 Singular=0;
+	s32 ii;
+
+	if(Row>_MATBATCH_MAX)
+	{
+		Type *Work=_BatchWorkPlus<Type>(2*Step);
+		for(ii=0;ii<((s32) Num);ii++)
+		{
+			Singular+=MiniMat_BatchKernel<Type>::Inv(Out+ii*Step,In+ii*Step,Row,Work)?0:1;
+		}
+		_BatchWorkMinus(Work,2*Step);
+	}
+	else if(Row==3)
+	{
+		_MATBATCH_COUNT
+		{
+			Type Work[18];
+			Singular+=MiniMat_BatchKernel<Type>::Inv(Out+ii*9,In+ii*9,3,Work)?0:1;
+		}
+	}
+	else if(Row==4)
+	{
+		_MATBATCH_COUNT
+		{
+			Type Work[32];
+			Singular+=MiniMat_BatchKernel<Type>::Inv(Out+ii*16,In+ii*16,4,Work)?0:1;
+		}
+	}
+	else if(Row==6)
+	{
+		_MATBATCH_COUNT
+		{
+			Type Work[72];
+			Singular+=MiniMat_BatchKernel<Type>::Inv(Out+ii*36,In+ii*36,6,Work)?0:1;
+		}
+	}
+	else
+	{
+		_MATBATCH_COUNT
+		{
+			Type Work[2*_MATBATCH_MAX*_MATBATCH_MAX];
+			Singular+=MiniMat_BatchKernel<Type>::Inv(Out+ii*Step,In+ii*Step,Row,Work)?0:1;
+		}
+	}
+	return Singular;
+}
+
+//Solve A[n]*X[n]=B[n] for Each Matrix of the Batches (B and X are Row*Col, Return Number of Singular Systems)
+template <class Type>
+
+u32 BatchSolve(Type *Out, const Type *InA, const Type *InB, u8 Row, u8 Col, u32 Num)
+{
+	u32 AStep=((u32) Row)*Row;
+	u32 BStep=((u32) Row)*Col;
+	u32 Singular=0;
+	s32 ii;
+
+	if((Row>_MATBATCH_MAX)||(Col>_MATBATCH_MAX))
+	{
+		Type *Work=_BatchWorkPlus<Type>(AStep+BStep);
+		for(ii=0;ii<((s32) Num);ii++)
+		{
+			Singular+=MiniMat_BatchKernel<Type>::Solve(Out+ii*BStep,InA+ii*AStep,InB+ii*BStep,Row,Col,Work)?0:1;
+		}
+		_BatchWorkMinus(Work,AStep+BStep);
+	}
+	else if((Row==3)&&(Col==1))
+	{
+		_MATBATCH_COUNT
+		{
+			Type Work[12];
+			Singular+=MiniMat_BatchKernel<Type>::Solve(Out+ii*3,InA+ii*9,InB+ii*3,3,1,Work)?0:1;
+		}
+	}
+	else if((Row==4)&&(Col==1))
+	{
+		_MATBATCH_COUNT
+		{
+			Type Work[20];
+			Singular+=MiniMat_BatchKernel<Type>::Solve(Out+ii*4,InA+ii*16,InB+ii*4,4,1,Work)?0:1;
+		}
+	}
+	else if((Row==6)&&(Col==1))
+	{
+		_MATBATCH_COUNT
+		{
+			Type Work[42];
+			Singular+=MiniMat_BatchKernel<Type>::Solve(Out+ii*6,InA+ii*36,InB+ii*6,6,1,Work)?0:1;
+		}
+	}
+	else
+	{
+		_MATBATCH_COUNT
+		{
+			Type Work[2*_MATBATCH_MAX*_MATBATCH_MAX];
+			Singular+=MiniMat_BatchKernel<Type>::Solve(Out+ii*BStep,InA+ii*AStep,InB+ii*BStep,Row,Col,Work)?0:1;
+		}
+	}
+	return Singular;
+}
+
+
+#endif
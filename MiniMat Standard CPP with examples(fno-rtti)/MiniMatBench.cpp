@@ -0,0 +1,386 @@
+/*
+*File Name: MiniMatBench.cpp
+*File Creation Date: October 18th 2026
+*File Final Revised Date: October 18th 2026
+*Author: Jiamin Wang
+*Description: Benchmark of MiniMat Operations
+*/
+
+/*
+*Note:
+*Standalone benchmark (its own main, do not link with Main.cpp), build and run on a desktop:
+*	g++ -std=c++98 -O2 -fno-rtti MiniMatBench.cpp MiniMat.cpp -o MiniMatBench
+*	./MiniMatBench [csv|json] [Minimum Time per Case in ms, default 20]
+*Every operation is timed for float, double, s16 and bool (where it exists) and sizes from 2x2 to 254x254 (1-based u8 loops of MiniMat cannot reach 255).
+*Det and Inv use cofactor expansion (O(n!)), so they stop at 8x8 and 6x6; Cross is 3x1 only.
+*One row per case: ns per operation, GFLOP/s (nominal count of the algorithm in MiniMat), heap bytes and malloc calls per operation.
+*Bytes and mallocs come from MiniMat_HeapScope, so _HEAPSCOPE must be enabled.
+*Results go to stdout, e.g. ./MiniMatBench csv > Old.csv, then diff against the next version.
+*/
+
+#include "MiniMat.hpp"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#if !_HEAPSCOPE
+	#error "MiniMatBench Needs _HEAPSCOPE for Allocation Counts"
+#endif
+
+
+
+//Benchmark Operands of One Type and Size (Storage Owned Here, so Inputs are Not Counted as Heap)
+template <class Type>
+
+class BenchCase
+{
+public:
+	Mat<Type> A;//N x N Input
+	Mat<Type> B;//N x N Input
+	Mat<Type> C;//N x N Output
+	Mat<Type> Vec;//N x 1 Input
+	Mat<Type> Out;//N x 1 Output
+	Mat<Type> ValL;//3 x 1 Input of Cross
+	Mat<Type> ValR;//3 x 1 Input of Cross
+	Mat<Type> Cro;//3 x 1 Output of Cross
+	Mat<Type> Sml;//N-1 x N-1 Output of Sub
+	Mat<bool> Mask;//N x N Output of Comparisons
+	Type Sink;//Scalar Output
+	u8 N;
+
+	explicit BenchCase(u8 Size, Type *Buffer, bool *MaskBuffer):
+	A(Size,Size,Buffer),B(Size,Size,Buffer+Size*Size),C(Size,Size,Buffer+2*Size*Size),
+	Vec(Size,1,Buffer+3*Size*Size),Out(Size,1,Buffer+3*Size*Size+Size),
+	ValL(3,1,Buffer+3*Size*Size+2*Size),ValR(3,1,Buffer+3*Size*Size+2*Size+3),Cro(3,1,Buffer+3*Size*Size+2*Size+6),
+	Sml(Size-1,Size-1,Buffer+3*Size*Size+2*Size+9),Mask(Size,Size,MaskBuffer),Sink(0),N(Size)
+	{};
+
+	//Number of Type Elements Needed by the Constructor
+	static u32 Need(u8 Size)
+	{
+		return 4*((u32) Size)*Size+2*((u32) Size)+9;
+	}
+};
+
+//Operation Entry (Run Once, Nominal FLOPs, Size Limits)
+template <class Type>
+
+class BenchOp
+{
+public:
+	const char *Name;
+	void (*Run)(BenchCase<Type> &Case);
+	double (*Flop)(double N);
+	u8 MinN;
+	u8 MaxN;
+};
+
+
+
+//Nominal FLOP Counts
+double FlopZero(double N){return 0*N;}
+double FlopElem(double N){return N*N;}
+double FlopMult(double N){return 2*N*N*N;}
+double FlopGemv(double N){return 2*N*N;}
+double FlopCross(double N){return 9+0*N;}
+double FlopNorm(double N){return 2*N*N;}
+
+//Cofactor Expansion Used by Det (3x3 by Rule of Sarrus)
+double FlopDet(double N)
+{
+	if(N<=1)
+	{
+		return 0;
+	}
+	if(N<=2)
+	{
+		return 3;
+	}
+	if(N<=3)
+	{
+		return 17;
+	}
+	return N*(FlopDet(N-1)+3);
+}
+
+//Inverse by Adjugate (One Det of N and N*N Dets of N-1)
+double FlopInv(double N)
+{
+	return FlopDet(N)+N*N*(FlopDet(N-1)+2);
+}
+
+
+
+//Operations Valid for Every Type
+template <class Type> void RunTrans(BenchCase<Type> &Case){Case.C=~Case.A;}
+template <class Type> void RunEqual(BenchCase<Type> &Case){Case.Mask=(Case.A==Case.B);}
+
+//Operations of Numeric Types
+template <class Type> void RunMult(BenchCase<Type> &Case){Case.C=Case.A*Case.B;}
+template <class Type> void RunGemv(BenchCase<Type> &Case){Case.Out=Case.A*Case.Vec;}
+template <class Type> void RunPlus(BenchCase<Type> &Case){Case.C=Case.A+Case.B;}
+template <class Type> void RunMinus(BenchCase<Type> &Case){Case.C=Case.A-Case.B;}
+template <class Type> void RunScale(BenchCase<Type> &Case){Case.C=Case.A*((Type) 2);}
+template <class Type> void RunDet(BenchCase<Type> &Case){Case.Sink=Det(Case.A);}
+template <class Type> void RunInv(BenchCase<Type> &Case){Case.C=Case.A.Inv();}
+template <class Type> void RunSub(BenchCase<Type> &Case){Case.Sml=Sub(Case.A,2,2);}
+template <class Type> void RunCross(BenchCase<Type> &Case){Case.Cro=Cross(Case.ValL,Case.ValR);}
+template <class Type> void RunPoint(BenchCase<Type> &Case){Case.Sink=Point(Case.A,Case.B);}
+template <class Type> void RunSum(BenchCase<Type> &Case){Case.Sink=Sum(Case.A);}
+template <class Type> void RunMax(BenchCase<Type> &Case){Case.Sink=Max(Case.A);}
+template <class Type> void RunMin(BenchCase<Type> &Case){Case.Sink=Min(Case.A);}
+template <class Type> void RunNorm(BenchCase<Type> &Case){Case.Sink=Norm(Case.A);}
+template <class Type> void RunRowSum(BenchCase<Type> &Case){Case.Out=RowSum(Case.A);}
+template <class Type> void RunAbs(BenchCase<Type> &Case){Case.C=Abs(Case.A);}
+template <class Type> void RunBigger(BenchCase<Type> &Case){Case.Mask=(Case.A>Case.B);}
+template <class Type> void RunSmallerEq(BenchCase<Type> &Case){Case.Mask=(Case.A<=Case.B);}
+
+void RunMinMax(BenchCase<float> &Case){float Low,High; u16 ArgLow,ArgHigh; MinMax(Case.A,Low,High,ArgLow,ArgHigh); Case.Sink=Low+High;}
+void RunMinMax(BenchCase<double> &Case){double Low,High; u16 ArgLow,ArgHigh; MinMax(Case.A,Low,High,ArgLow,ArgHigh); Case.Sink=Low+High;}
+void RunMinMax(BenchCase<s16> &Case){s16 Low,High; u16 ArgLow,ArgHigh; MinMax(Case.A,Low,High,ArgLow,ArgHigh); Case.Sink=Low+High;}
+
+//Operations of bool
+void RunAnd(BenchCase<bool> &Case){Case.C=(Case.A&Case.B);}
+void RunOr(BenchCase<bool> &Case){Case.C=(Case.A|Case.B);}
+void RunXor(BenchCase<bool> &Case){Case.C=(Case.A^Case.B);}
+void RunNeg(BenchCase<bool> &Case){Case.C=Neg(Case.A);}
+
+
+
+//Monotonic Time in ns
+double BenchNow()
+{
+#if defined(CLOCK_MONOTONIC)
+	timespec Now;
+	clock_gettime(CLOCK_MONOTONIC,&Now);
+	return ((double) Now.tv_sec)*1e9+((double) Now.tv_nsec);
+#else
+	return ((double) clock())*(1e9/CLOCKS_PER_SEC);
+#endif
+}
+
+//Output Format and Settings
+class BenchOut
+{
+public:
+	bool IsJson;
+	bool IsFirst;
+	double MinTime;//ns
+
+	explicit BenchOut():IsJson(0),IsFirst(1),MinTime(20e6){};
+
+	void Begin()
+	{
+		if(IsJson)
+		{
+			printf("[\n");
+		}
+		else
+		{
+			printf("op,type,rows,cols,reps,ns_per_op,gflops,bytes_per_op,mallocs_per_op\n");
+		}
+	}
+
+	void Row(const char *Op, const char *TypeName, u8 Row, u8 Col, u32 Reps, double NsOp, double Gflops, u32 Bytes, u32 Mallocs)
+	{
+		if(IsJson)
+		{
+			printf("%s  {\"op\": \"%s\", \"type\": \"%s\", \"rows\": %u, \"cols\": %u, \"reps\": %lu, \"ns_per_op\": %.2f, \"gflops\": %.4f, \"bytes_per_op\": %lu, \"mallocs_per_op\": %lu}",
+				IsFirst?"":",\n",Op,TypeName,(unsigned) Row,(unsigned) Col,Reps,NsOp,Gflops,Bytes,Mallocs);
+		}
+		else
+		{
+			printf("%s,%s,%u,%u,%lu,%.2f,%.4f,%lu,%lu\n",Op,TypeName,(unsigned) Row,(unsigned) Col,Reps,NsOp,Gflops,Bytes,Mallocs);
+		}
+		IsFirst=0;
+		fflush(stdout);
+	}
+
+	void End()
+	{
+		if(IsJson)
+		{
+			printf("\n]\n");
+		}
+	}
+};
+
+
+
+//Fill Inputs with Well Conditioned Values (Diagonal Dominant so Inv Exists)
+template <class Type>
+
+void BenchFill(BenchCase<Type> &Case)
+{
+	Type *APtr=Case.A.Pt();
+	Type *BPtr=Case.B.Pt();
+	u16 ii;
+
+	for (ii=0;ii<Case.A.Sz();ii++)
+	{
+		*(APtr+ii)=(Type) ((ii*7)%13)-(Type) 6;
+		*(BPtr+ii)=(Type) ((ii*5)%11)-(Type) 5;
+	}
+	for (ii=0;ii<Case.N;ii++)
+	{
+		*(APtr+ii*Case.N+ii)=(Type) (4*Case.N);
+		*(Case.Vec.Pt()+ii)=(Type) (ii%5)-(Type) 2;
+	}
+	for (ii=0;ii<3;ii++)
+	{
+		*(Case.ValL.Pt()+ii)=(Type) (ii+1);
+		*(Case.ValR.Pt()+ii)=(Type) (3-ii);
+	}
+}
+
+void BenchFill(BenchCase<bool> &Case)
+{
+	u16 ii;
+
+	for (ii=0;ii<Case.A.Sz();ii++)
+	{
+		*(Case.A.Pt()+ii)=((ii%3)==0);
+		*(Case.B.Pt()+ii)=((ii%2)==0);
+	}
+}
+
+//Time One Operation at One Size (Warm-up, then Double Repetitions until MinTime)
+template <class Type>
+
+void BenchRun(BenchOut &Output, const BenchOp<Type> &Op, const char *TypeName, u8 N)
+{
+	Type *Buffer=(Type *) malloc(sizeof(Type)*BenchCase<Type>::Need(N));
+	bool *MaskBuffer=(bool *) malloc(sizeof(bool)*((u32) N)*N);
+	BenchCase<Type> Case(N,Buffer,MaskBuffer);
+	u32 Bytes,Mallocs,Reps,ii;
+	double Start,Elapsed;
+
+	BenchFill(Case);
+
+	Bytes=MiniMat_HeapScope._TotalByte;
+	Mallocs=MiniMat_HeapScope._TotalTempNum;
+	Op.Run(Case);
+	Bytes=MiniMat_HeapScope._TotalByte-Bytes;
+	Mallocs=MiniMat_HeapScope._TotalTempNum-Mallocs;
+
+	Reps=1;
+	while(1)
+	{
+		BenchFill(Case);
+		Start=BenchNow();
+		for (ii=0;ii<Reps;ii++)
+		{
+			Op.Run(Case);
+		}
+		Elapsed=BenchNow()-Start;
+		if((Elapsed>=Output.MinTime)||(Reps>=(1UL<<30)))
+		{
+			break;
+		}
+		Reps*=2;
+	}
+
+	if(Op.Flop==FlopCross)
+	{
+		Output.Row(Op.Name,TypeName,3,1,Reps,Elapsed/Reps,Op.Flop(N)/(Elapsed/Reps),Bytes,Mallocs);
+	}
+	else
+	{
+		Output.Row(Op.Name,TypeName,N,N,Reps,Elapsed/Reps,Op.Flop(N)/(Elapsed/Reps),Bytes,Mallocs);
+	}
+
+	free(Buffer);
+	free(MaskBuffer);
+}
+
+//Run All Operations over All Sizes
+template <class Type>
+
+void BenchType(BenchOut &Output, const BenchOp<Type> *Ops, u8 OpNum, const char *TypeName)
+{
+	const u8 Sizes[]={2,3,4,6,8,16,32,64,128,254};
+	u8 ii,jj;
+
+	for (ii=0;ii<OpNum;ii++)
+	{
+		for (jj=0;jj<sizeof(Sizes);jj++)
+		{
+			if((Sizes[jj]>=Ops[ii].MinN)&&(Sizes[jj]<=Ops[ii].MaxN))
+			{
+				BenchRun(Output,Ops[ii],TypeName,Sizes[jj]);
+			}
+		}
+	}
+}
+
+//Operation Table of Numeric Types
+template <class Type>
+
+void BenchNumeric(BenchOut &Output, const char *TypeName, bool HasInv)
+{
+	const BenchOp<Type> Ops[]={
+		{"operator*",RunMult<Type>,FlopMult,2,254},
+		{"operator*(vec)",RunGemv<Type>,FlopGemv,2,254},
+		{"operator+",RunPlus<Type>,FlopElem,2,254},
+		{"operator-",RunMinus<Type>,FlopElem,2,254},
+		{"operator*(value)",RunScale<Type>,FlopElem,2,254},
+		{"operator~",RunTrans<Type>,FlopZero,2,254},
+		{"Det",RunDet<Type>,FlopDet,2,8},
+		{"Inv",RunInv<Type>,FlopInv,2,(u8) (HasInv?6:0)},
+		{"Sub",RunSub<Type>,FlopZero,3,254},
+		{"Cross",RunCross<Type>,FlopCross,3,3},
+		{"Point",RunPoint<Type>,FlopGemv,2,254},
+		{"Sum",RunSum<Type>,FlopElem,2,254},
+		{"Max",RunMax<Type>,FlopElem,2,254},
+		{"Min",RunMin<Type>,FlopElem,2,254},
+		{"MinMax",RunMinMax,FlopGemv,2,254},
+		{"Norm",RunNorm<Type>,FlopNorm,2,254},
+		{"RowSum",RunRowSum<Type>,FlopElem,2,254},
+		{"Abs",RunAbs<Type>,FlopElem,2,254},
+		{"operator>",RunBigger<Type>,FlopElem,2,254},
+		{"operator<=",RunSmallerEq<Type>,FlopElem,2,254},
+		{"operator==",RunEqual<Type>,FlopElem,2,254}
+	};
+
+	BenchType<Type>(Output,Ops,sizeof(Ops)/sizeof(Ops[0]),TypeName);
+}
+
+//Operation Table of bool
+void BenchBool(BenchOut &Output)
+{
+	const BenchOp<bool> Ops[]={
+		{"operator&",RunAnd,FlopElem,2,254},
+		{"operator|",RunOr,FlopElem,2,254},
+		{"operator^",RunXor,FlopElem,2,254},
+		{"Neg",RunNeg,FlopElem,2,254},
+		{"operator~",RunTrans<bool>,FlopZero,2,254},
+		{"operator==",RunEqual<bool>,FlopElem,2,254}
+	};
+
+	BenchType<bool>(Output,Ops,sizeof(Ops)/sizeof(Ops[0]),"bool");
+}
+
+
+
+int main(int argc, char **argv)
+{
+	BenchOut Output;
+
+	if((argc>1)&&(strcmp(argv[1],"json")==0))
+	{
+		Output.IsJson=1;
+	}
+	if(argc>2)
+	{
+		Output.MinTime=atof(argv[2])*1e6;
+	}
+
+	Output.Begin();
+	BenchNumeric<float>(Output,"float",1);
+	BenchNumeric<double>(Output,"double",1);
+	BenchNumeric<s16>(Output,"s16",0);
+	BenchBool(Output);
+	Output.End();
+
+	return 0;
+}
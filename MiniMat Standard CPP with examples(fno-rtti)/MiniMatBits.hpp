@@ -0,0 +1,697 @@
+/*
+*File Name: MiniMatBits.hpp
+*File Creation Date: October 18th 2026
+*File Final Revised Date: October 18th 2026
+*Author: Jiamin Wang
+*Description: Bit Packed Boolean Matrix of MiniMat
+*/
+
+/*
+*Note:
+*BitMat stores one element per bit (row major, 64 elements per word), which is 8 times smaller than Mat<bool>.
+*Logic operations (&, |, ^, Neg) work on whole 64 bits words, Count/Any/All use popcount.
+*Rows and columns are u16, so BitMat can be much larger than Mat (e.g. occupancy grids).
+*Gt/Lt/Ge/Le/Eq/Ne compare Mat with Mat or with a single value and give packed masks instead of Mat<bool>.
+*Where(Mask,A,B) selects elements and Mat::MaskedSet(Mask,Value/Mat) assigns elements in one pass.
+*Bits after the last element in the last word are never read by Count/Any/All, so they do not need to be cleared.
+*Same as Mat, all of the "friend" and "operator overloading" functions will destroy the input object if is temporary.
+*/
+
+#ifndef MINIMATBITS_HPP_
+#define MINIMATBITS_HPP_
+
+#include "MiniMat.hpp"
+
+#define _BITS_WORD(ROW,COL) ((((u32) (ROW))*((u32) (COL))+63)/64)//Number of 64 Bits Words
+
+//Define a fixed bit matrix
+#define DefBits(NAME,ROW,COL) \
+	u64 MACON(NAME,DEFBITS)[_BITS_WORD(ROW,COL)];\
+	BitMat NAME( (u16) ROW , (u16) COL , ((u64 *) &(MACON(NAME,DEFBITS)[0])) );
+
+//Define a return bit matrix (temporary)
+#if _HEAPSCOPE
+	#define TmpBits(NAME,ROW,COL) \
+			u64 *MACON(NAME,TMPBITS)=(u64 *) malloc(sizeof(u64)*_BITS_WORD(ROW,COL));\
+			MiniMat_HeapScope._HeapPlus(((u32) sizeof(u64))*_BITS_WORD(ROW,COL));\
+			BitMat NAME( (u16) ROW , (u16) COL , MACON(NAME,TMPBITS) );\
+			NAME.SetTemp();
+
+	#define RetBits(NAME,ROW,COL) \
+			u64 *MACON(NAME,RETBITS)=(u64 *) malloc(sizeof(u64)*_BITS_WORD(ROW,COL));\
+			MiniMat_HeapScope._HeapPlus(((u32) sizeof(u64))*_BITS_WORD(ROW,COL));\
+			BitMat NAME( (u16) ROW , (u16) COL , MACON(NAME,RETBITS) );\
+			NAME.SetReturn();
+#else
+	#define TmpBits(NAME,ROW,COL) \
+			u64 *MACON(NAME,TMPBITS)=(u64 *) malloc(sizeof(u64)*_BITS_WORD(ROW,COL));\
+			BitMat NAME( (u16) ROW , (u16) COL , MACON(NAME,TMPBITS) );\
+			NAME.SetTemp();
+
+	#define RetBits(NAME,ROW,COL) \
+			u64 *MACON(NAME,RETBITS)=(u64 *) malloc(sizeof(u64)*_BITS_WORD(ROW,COL));\
+			BitMat NAME( (u16) ROW , (u16) COL , MACON(NAME,RETBITS) );\
+			NAME.SetReturn();
+#endif
+
+
+
+class BitMat
+{
+
+protected://Variables (None of the variables can be directly accessed)
+
+	bool _IsTemp;//Indicate Temperorary Status
+	bool _IsReturn;//Indicate Global Variable Status
+
+	u64 *_Value;//Root Pointer of Words
+	u16 _Row;//Number of Rows
+	u16 _Col;//Number of Columns
+	u32 _Size;//Number of Elements
+	u32 _Word;//Number of Words
+
+	//Number of Set Bits in a Word
+	static u8 _Pop(u64 Word)
+	{
+#if defined(__GNUC__)
+		return (u8) __builtin_popcountll(Word);
+#else
+		Word=Word-((Word>>1)&0x5555555555555555ULL);
+		Word=(Word&0x3333333333333333ULL)+((Word>>2)&0x3333333333333333ULL);
+		Word=(Word+(Word>>4))&0x0f0f0f0f0f0f0f0fULL;
+		return (u8) ((Word*0x0101010101010101ULL)>>56);
+#endif
+	}
+
+	//Valid Bits of the Last Word
+	u64 _Tail()
+	{
+		return ((_Size%64)==0)?(~((u64) 0)):((((u64) 1)<<(_Size%64))-1);
+	}
+
+
+
+public://Functions
+
+	//////Constrcutors & Destructors
+
+	//Global Variable Constructor
+	explicit BitMat(u16 Row, u16 Col, u64 *Value):
+	_IsTemp(0),_IsReturn(0),
+	_Value(Value),_Row(Row),_Col(Col),
+	_Size(((u32) Row)*((u32) Col)),_Word(_BITS_WORD(Row,Col))
+	{};
+
+	//Variable Destructor (Designed for Regional Variable)
+	~BitMat(){};
+
+	//////End of Constrcutors & Destructors
+
+
+
+	//////Content Operation (These Functions Work on Itself)
+
+	//Set Temp Status
+	BitMat & SetTemp()
+	{
+		_IsTemp=1;
+		return *this;
+	}
+
+	//Set Return Status
+	BitMat & SetReturn()
+	{
+		_IsReturn=1;
+		return *this;
+	}
+
+	//Clean Temp
+	void CleanTmp()
+	{
+		if(_IsTemp)
+		{
+#if _HEAPSCOPE
+			MiniMat_HeapScope._HeapMinus(((u32) sizeof(u64))*_Word);
+#endif
+			free(_Value);
+			_Value=NULL;
+		}
+		return;
+	}
+
+	//Clean Return After Use
+	void CleanRet()
+	{
+		if(_IsReturn)
+		{
+#if _HEAPSCOPE
+			MiniMat_HeapScope._HeapMinus(((u32) sizeof(u64))*_Word);
+#endif
+			free(_Value);
+			_Value=NULL;
+		}
+		return;
+	}
+
+	//Insert Single Value
+	BitMat & operator()(u16 Row, u16 Col, bool Value)
+	{
+		u32 Idx=((u32) (Row-1))*_Col+(Col-1);
+		if(Value)
+		{
+			*(_Value+Idx/64)|=((u64) 1)<<(Idx%64);
+		}
+		else
+		{
+			*(_Value+Idx/64)&=~(((u64) 1)<<(Idx%64));
+		}
+		return *this;
+	}
+
+	//Set All Elements to Same Value
+	BitMat & operator=(bool EqualValue)
+	{
+		u64 Word=EqualValue?(~((u64) 0)):0;
+		u32 ii;
+		for(ii=0;ii<_Word;ii++)
+		{
+			*(_Value+ii)=Word;
+		}
+		return *this;
+	}
+
+	//Bit Matrix Equality (This will destroy Input BitMat if is Temp BitMat)
+	BitMat & operator=(BitMat EqualBits)
+	{
+		u32 ii;
+		for(ii=0;ii<_Word;ii++)
+		{
+			*(_Value+ii)=*(EqualBits._Value+ii);
+		}
+
+		EqualBits.CleanRet();
+
+		return *this;
+	}
+
+	//Pack a Boolean Matrix (This will destroy Input Mat if is Temp Mat)
+	BitMat & operator=(Mat<bool> EqualMat)
+	{
+		bool *_Ptr1=EqualMat.Pt();
+		u64 Word;
+		u32 ii,jj,Num;
+		for(ii=0;ii<_Word;ii++)
+		{
+			Word=0;
+			Num=((_Size-ii*64)<64)?(_Size-ii*64):64;
+			for(jj=0;jj<Num;jj++)
+			{
+				Word|=((u64) (*_Ptr1))<<jj;
+				_Ptr1++;
+			}
+			*(_Value+ii)=Word;
+		}
+
+		EqualMat.CleanRet();
+
+		return *this;
+	}
+
+	//Calculate Equal from Logic AND
+	BitMat & operator&=(BitMat BoolBits)
+	{
+		u32 ii;
+		for(ii=0;ii<_Word;ii++)
+		{
+			*(_Value+ii)&=*(BoolBits._Value+ii);
+		}
+
+		BoolBits.CleanRet();
+
+		return *this;
+	}
+
+	//Calculate Equal from Logic OR
+	BitMat & operator|=(BitMat BoolBits)
+	{
+		u32 ii;
+		for(ii=0;ii<_Word;ii++)
+		{
+			*(_Value+ii)|=*(BoolBits._Value+ii);
+		}
+
+		BoolBits.CleanRet();
+
+		return *this;
+	}
+
+	//Calculate Equal from Logic XOR
+	BitMat & operator^=(BitMat BoolBits)
+	{
+		u32 ii;
+		for(ii=0;ii<_Word;ii++)
+		{
+			*(_Value+ii)^=*(BoolBits._Value+ii);
+		}
+
+		BoolBits.CleanRet();
+
+		return *this;
+	}
+
+	//Negative Operation on Itself
+	BitMat & Flip()
+	{
+		u32 ii;
+		for(ii=0;ii<_Word;ii++)
+		{
+			*(_Value+ii)=~(*(_Value+ii));
+		}
+		return *this;
+	}
+
+	//////End of Content operation
+
+
+
+#if !_MICROCHIP
+	//Print the Bit Matrix on Console
+	void Print()
+	{
+		u16 ii,jj;
+		u32 Idx=0;
+		cout<<endl;
+		for(ii=0;ii<_Row;ii++)
+		{
+			for(jj=0;jj<_Col;jj++)
+			{
+				cout<<((*(_Value+Idx/64)>>(Idx%64))&1);
+				Idx++;
+			}
+			cout<<endl;
+		}
+		cout<<endl;
+		return;
+	}
+#endif
+
+
+
+	//////Self Interaction (These functions, if correctly used, generates new things)
+
+	//FeedBack RowNum
+	u16 Ro()
+	{
+		return _Row;
+	}
+
+	//FeedBack ColNum
+	u16 Co()
+	{
+		return _Col;
+	}
+
+	//FeedBack Size
+	u32 Sz()
+	{
+		return _Size;
+	}
+
+	//FeedBack Memory Space
+	u32 Sp()
+	{
+		return ((u32) sizeof(u64))*_Word;
+	}
+
+	//FeedBack Root Pointer of Words (Use with Caution)
+	u64 * Pt()
+	{
+		return _Value;
+	}
+
+	//Extract Single Value
+	bool Val(u16 Row, u16 Col)
+	{
+		u32 Idx=((u32) (Row-1))*_Col+(Col-1);
+		return (bool) ((*(_Value+Idx/64)>>(Idx%64))&1);
+	}
+
+	//Extract Single Value
+	bool operator()(u16 Row, u16 Col)
+	{
+		return Val(Row,Col);
+	}
+
+	//Unpack to Boolean Matrix (Dimensions must fit in Mat)
+	Mat<bool> Full()
+	{
+		RetMat(bool,NewMat,(u8) _Row,(u8) _Col);
+		bool *_Ptr1=NewMat.Pt();
+		u32 ii;
+		for(ii=0;ii<_Size;ii++)
+		{
+			*_Ptr1=(bool) ((*(_Value+ii/64)>>(ii%64))&1);
+			_Ptr1++;
+		}
+		return NewMat;
+	}
+
+	//Count True Elements
+	u32 Count()
+	{
+		u32 SumVal=0;
+		u32 ii;
+		for(ii=0;ii+1<_Word;ii++)
+		{
+			SumVal+=_Pop(*(_Value+ii));
+		}
+		if(_Word>0)
+		{
+			SumVal+=_Pop((*(_Value+_Word-1))&_Tail());
+		}
+		return SumVal;
+	}
+
+	//Count True Elements (This will destroy Input BitMat if is Temp BitMat)
+	friend u32 Count(BitMat BoolBits)
+	{
+		u32 SumVal=BoolBits.Count();
+		BoolBits.CleanRet();
+		return SumVal;
+	}
+
+	//Check Any True Element
+	bool Any()
+	{
+		u32 ii;
+		for(ii=0;ii+1<_Word;ii++)
+		{
+			if(*(_Value+ii)!=0)
+			{
+				return 1;
+			}
+		}
+		return (_Word>0)&&(((*(_Value+_Word-1))&_Tail())!=0);
+	}
+
+	//Check Any True Element (This will destroy Input BitMat if is Temp BitMat)
+	friend bool Any(BitMat BoolBits)
+	{
+		bool Result=BoolBits.Any();
+		BoolBits.CleanRet();
+		return Result;
+	}
+
+	//Check All True Elements
+	bool All()
+	{
+		u32 ii;
+		for(ii=0;ii+1<_Word;ii++)
+		{
+			if(*(_Value+ii)!=(~((u64) 0)))
+			{
+				return 0;
+			}
+		}
+		return (_Word==0)||(((*(_Value+_Word-1))&_Tail())==_Tail());
+	}
+
+	//Check All True Elements (This will destroy Input BitMat if is Temp BitMat)
+	friend bool All(BitMat BoolBits)
+	{
+		bool Result=BoolBits.All();
+		BoolBits.CleanRet();
+		return Result;
+	}
+
+	//Negative Operation
+	BitMat Neg()
+	{
+		RetBits(NewBits,_Row,_Col);
+		u32 ii;
+		for(ii=0;ii<_Word;ii++)
+		{
+			*(NewBits._Value+ii)=~(*(_Value+ii));
+		}
+		return NewBits;
+	}
+
+	//Negative Operation (This will destroy Operated BitMat if is Temp BitMat)
+	friend BitMat Neg(BitMat BoolBits)
+	{
+		RetBits(NewBits,BoolBits._Row,BoolBits._Col);
+		u32 ii;
+		for(ii=0;ii<BoolBits._Word;ii++)
+		{
+			*(NewBits._Value+ii)=~(*(BoolBits._Value+ii));
+		}
+
+		BoolBits.CleanRet();
+
+		return NewBits;
+	}
+
+	//////End of Self Interaction
+
+
+
+	//////Interaction Between Bit Matrixes
+
+	//Logic AND
+	friend BitMat operator&(BitMat BoolBitsL, BitMat BoolBitsR)
+	{
+		RetBits(NewBits,BoolBitsL._Row,BoolBitsL._Col);
+		u32 ii;
+		for(ii=0;ii<NewBits._Word;ii++)
+		{
+			*(NewBits._Value+ii)=(*(BoolBitsL._Value+ii))&(*(BoolBitsR._Value+ii));
+		}
+
+		BoolBitsL.CleanRet();
+		BoolBitsR.CleanRet();
+
+		return NewBits;
+	}
+
+	//Logic OR
+	friend BitMat operator|(BitMat BoolBitsL, BitMat BoolBitsR)
+	{
+		RetBits(NewBits,BoolBitsL._Row,BoolBitsL._Col);
+		u32 ii;
+		for(ii=0;ii<NewBits._Word;ii++)
+		{
+			*(NewBits._Value+ii)=(*(BoolBitsL._Value+ii))|(*(BoolBitsR._Value+ii));
+		}
+
+		BoolBitsL.CleanRet();
+		BoolBitsR.CleanRet();
+
+		return NewBits;
+	}
+
+	//Logic XOR
+	friend BitMat operator^(BitMat BoolBitsL, BitMat BoolBitsR)
+	{
+		RetBits(NewBits,BoolBitsL._Row,BoolBitsL._Col);
+		u32 ii;
+		for(ii=0;ii<NewBits._Word;ii++)
+		{
+			*(NewBits._Value+ii)=(*(BoolBitsL._Value+ii))^(*(BoolBitsR._Value+ii));
+		}
+
+		BoolBitsL.CleanRet();
+		BoolBitsR.CleanRet();
+
+		return NewBits;
+	}
+
+	//////End of Interaction Between Bit Matrixes
+
+};
+
+
+
+//Element Comparisons Used by Packed Masks
+class _BitsGt{public: template <class Type> static bool Do(Type ValL, Type ValR){return ValL>ValR;}};
+class _BitsLt{public: template <class Type> static bool Do(Type ValL, Type ValR){return ValL<ValR;}};
+class _BitsGe{public: template <class Type> static bool Do(Type ValL, Type ValR){return ValL>=ValR;}};
+class _BitsLe{public: template <class Type> static bool Do(Type ValL, Type ValR){return ValL<=ValR;}};
+class _BitsEq{public: template <class Type> static bool Do(Type ValL, Type ValR){return ValL==ValR;}};
+class _BitsNe{public: template <class Type> static bool Do(Type ValL, Type ValR){return ValL!=ValR;}};
+
+//Compare Two Matrixes into a Packed Mask (Step 0 of Right Pointer Compares with a Single Value)
+template <class Cmp, class Type>
+
+void _BitsCompare(BitMat &NewBits, Type *LPtr, Type *RPtr, u8 RStep)
+{
+	u64 *WPtr=NewBits.Pt();
+	u64 Word;
+	u32 ii,jj,Num;
+	for(ii=0;ii<NewBits.Sz();ii+=64)
+	{
+		Word=0;
+		Num=((NewBits.Sz()-ii)<64)?(NewBits.Sz()-ii):64;
+		for(jj=0;jj<Num;jj++)
+		{
+			Word|=((u64) Cmp::Do(*LPtr,*RPtr))<<jj;
+			LPtr++;
+			RPtr+=RStep;
+		}
+		*WPtr=Word;
+		WPtr++;
+	}
+}
+
+//Define Packed Comparisons between Mat and Mat or Single Value (Destroy Inputs if are Temp Mat)
+#define _BITS_COMPARE(NAME,CMP) \
+	template <class Type> \
+	BitMat NAME(Mat<Type> CompareMatL, Mat<Type> CompareMatR) \
+	{ \
+		RetBits(NewBits,CompareMatL.Ro(),CompareMatL.Co()); \
+		_BitsCompare<CMP,Type>(NewBits,CompareMatL.Pt(),CompareMatR.Pt(),1); \
+		CompareMatL.CleanRet(); \
+		CompareMatR.CleanRet(); \
+		return NewBits; \
+	} \
+	template <class Type> \
+	BitMat NAME(Mat<Type> CompareMat, Type CompareValue) \
+	{ \
+		RetBits(NewBits,CompareMat.Ro(),CompareMat.Co()); \
+		_BitsCompare<CMP,Type>(NewBits,CompareMat.Pt(),&CompareValue,0); \
+		CompareMat.CleanRet(); \
+		return NewBits; \
+	}
+
+_BITS_COMPARE(Gt,_BitsGt)//Packed Compare Bigger
+_BITS_COMPARE(Lt,_BitsLt)//Packed Compare Smaller
+_BITS_COMPARE(Ge,_BitsGe)//Packed Compare No Smaller
+_BITS_COMPARE(Le,_BitsLe)//Packed Compare No Bigger
+_BITS_COMPARE(Eq,_BitsEq)//Packed Compare Equal
+_BITS_COMPARE(Ne,_BitsNe)//Packed Compare Inequal
+
+//Select Elements of A where Mask is True and B Otherwise (Destroy Inputs if are Temp)
+template <class Type>
+
+Mat<Type> Where(BitMat Mask, Mat<Type> CalcMatA, Mat<Type> CalcMatB)
+{
+	RetMat(Type,NewMat,CalcMatA.Ro(),CalcMatA.Co());
+	Type *OPtr=NewMat.Pt();
+	Type *APtr=CalcMatA.Pt();
+	Type *BPtr=CalcMatB.Pt();
+	u64 *WPtr=Mask.Pt();
+	u64 Word;
+	u32 ii,jj,Num;
+	for(ii=0;ii<Mask.Sz();ii+=64)
+	{
+		Word=*WPtr;
+		Num=((Mask.Sz()-ii)<64)?(Mask.Sz()-ii):64;
+		for(jj=0;jj<Num;jj++)
+		{
+			*(OPtr+jj)=((Word>>jj)&1)?(*(APtr+jj)):(*(BPtr+jj));
+		}
+		OPtr+=Num;
+		APtr+=Num;
+		BPtr+=Num;
+		WPtr++;
+	}
+
+	Mask.CleanRet();
+	CalcMatA.CleanRet();
+	CalcMatB.CleanRet();
+
+	return NewMat;
+}
+
+//Select Elements of A where Mask is True and a Single Value Otherwise (Destroy Inputs if are Temp)
+template <class Type>
+
+Mat<Type> Where(BitMat Mask, Mat<Type> CalcMatA, Type Value)
+{
+	RetMat(Type,NewMat,CalcMatA.Ro(),CalcMatA.Co());
+	Type *OPtr=NewMat.Pt();
+	Type *APtr=CalcMatA.Pt();
+	u64 *WPtr=Mask.Pt();
+	u64 Word;
+	u32 ii,jj,Num;
+	for(ii=0;ii<Mask.Sz();ii+=64)
+	{
+		Word=*WPtr;
+		Num=((Mask.Sz()-ii)<64)?(Mask.Sz()-ii):64;
+		for(jj=0;jj<Num;jj++)
+		{
+			*(OPtr+jj)=((Word>>jj)&1)?(*(APtr+jj)):Value;
+		}
+		OPtr+=Num;
+		APtr+=Num;
+		WPtr++;
+	}
+
+	Mask.CleanRet();
+	CalcMatA.CleanRet();
+
+	return NewMat;
+}
+
+//Set Elements to Same Value where Mask is True (Skip Whole Words without True Elements)
+template <class Type>
+
+Mat<Type> & Mat<Type>::MaskedSet(BitMat Mask, Type Value)
+{
+	Type *_Ptr1=_Value;
+	u64 *WPtr=Mask.Pt();
+	u64 Word;
+	u32 ii,jj,Num;
+	for(ii=0;ii<_Size;ii+=64)
+	{
+		Word=*WPtr;
+		Num=((_Size-ii)<64)?(_Size-ii):64;
+		if(Word!=0)
+		{
+			for(jj=0;jj<Num;jj++)
+			{
+				*(_Ptr1+jj)=((Word>>jj)&1)?Value:(*(_Ptr1+jj));
+			}
+		}
+		_Ptr1+=Num;
+		WPtr++;
+	}
+
+	Mask.CleanRet();
+
+	return *this;
+}
+
+//Copy Elements where Mask is True (Skip Whole Words without True Elements)
+template <class Type>
+
+Mat<Type> & Mat<Type>::MaskedSet(BitMat Mask, Mat<Type> SetMat)
+{
+	Type *_Ptr1=_Value;
+	Type *_Ptr2=SetMat._Value;
+	u64 *WPtr=Mask.Pt();
+	u64 Word;
+	u32 ii,jj,Num;
+	for(ii=0;ii<_Size;ii+=64)
+	{
+		Word=*WPtr;
+		Num=((_Size-ii)<64)?(_Size-ii):64;
+		if(Word!=0)
+		{
+			for(jj=0;jj<Num;jj++)
+			{
+				*(_Ptr1+jj)=((Word>>jj)&1)?(*(_Ptr2+jj)):(*(_Ptr1+jj));
+			}
+		}
+		_Ptr1+=Num;
+		_Ptr2+=Num;
+		WPtr++;
+	}
+
+	Mask.CleanRet();
+	SetMat.CleanRet();
+
+	return *this;
+}
+
+
+#endif
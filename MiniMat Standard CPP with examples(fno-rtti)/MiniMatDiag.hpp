@@ -0,0 +1,638 @@
+/*
+*File Name: MiniMatDiag.hpp
+*File Creation Date: October 18th 2026
+*File Final Revised Date: October 18th 2026
+*Author: Jiamin Wang
+*Description: Diagonal and Identity Matrix of MiniMat
+*/
+
+/*
+*Note:
+*DiagMat only stores the diagonal, so a N*N diagonal matrix costs N elements instead of N*N.
+*Identity matrix (DefEye) stores nothing at all.
+*Products and sums with Mat are done by row/column scaling (O(N^2)) instead of full matrix multiplication (O(N^3)).
+*Same as Mat, all of the "friend" and "operator overloading" functions will destroy the input object if is temporary.
+*/
+
+#ifndef MINIMATDIAG_HPP_
+#define MINIMATDIAG_HPP_
+
+#include "MiniMat.hpp"
+
+//Define a fixed diagonal matrix
+#define DefDiag(TYPE,NAME,ROW) \
+	TYPE MACON(NAME,DEFDIAG)[((const u16) ROW)];\
+	DiagMat<TYPE> NAME( (u8) ROW , ((TYPE *) &(MACON(NAME,DEFDIAG)[0])) );
+
+//Define an identity matrix (no storage)
+#define DefEye(TYPE,NAME,ROW) \
+	DiagMat<TYPE> NAME( (u8) ROW , ((TYPE *) NULL) );
+
+//Define a return diagonal matrix (temporary)
+#if _HEAPSCOPE
+	#define TmpDiag(TYPE,NAME,ROW) \
+			TYPE *MACON(NAME,TMPDIAG)=(TYPE *) malloc(sizeof(TYPE)*((const u16) ROW));\
+			MiniMat_HeapScope._HeapPlus((sizeof(TYPE)*((u32) ROW)));\
+			DiagMat<TYPE> NAME( (u8) ROW , MACON(NAME,TMPDIAG) );\
+			NAME.SetTemp();
+
+	#define RetDiag(TYPE,NAME,ROW) \
+			TYPE *MACON(NAME,RETDIAG)=(TYPE *) malloc(sizeof(TYPE)*((const u16) ROW));\
+			MiniMat_HeapScope._HeapPlus((sizeof(TYPE)*((u32) ROW)));\
+			DiagMat<TYPE> NAME( (u8) ROW , MACON(NAME,RETDIAG) );\
+			NAME.SetReturn();
+#else
+	#define TmpDiag(TYPE,NAME,ROW) \
+			TYPE *MACON(NAME,TMPDIAG)=(TYPE *) malloc(sizeof(TYPE)*((const u16) ROW));\
+			DiagMat<TYPE> NAME( (u8) ROW , MACON(NAME,TMPDIAG) );\
+			NAME.SetTemp();
+
+	#define RetDiag(TYPE,NAME,ROW) \
+			TYPE *MACON(NAME,RETDIAG)=(TYPE *) malloc(sizeof(TYPE)*((const u16) ROW));\
+			DiagMat<TYPE> NAME( (u8) ROW , MACON(NAME,RETDIAG) );\
+			NAME.SetReturn();
+#endif
+
+
+
+template <class Type>
+
+class DiagMat
+{
+
+protected://Variables (None of the variables can be directly accessed)
+
+	Type *_IPtr;//Input Operating Pointer
+
+	bool _IsIdentity;//Indicate Identity Status (No Storage)
+
+	bool _IsTemp;//Indicate Temperorary Status
+	bool _IsReturn;//Indicate Global Variable Status
+
+	Type *_Value;//Root Pointer of Diagonal Elements
+	u8 _Row;//Number of Rows (Same as Number of Columns)
+
+
+
+public://Functions
+
+	//////Constrcutors & Destructors
+
+	//Global Variable Constructor (NULL Value for Identity)
+	explicit DiagMat(u8 Row, Type *Value):
+	_IPtr(Value),
+	_IsIdentity(Value==NULL),
+	_IsTemp(0),_IsReturn(0),
+	_Value(Value),_Row(Row)
+	{};
+
+	//Variable Destructor (Designed for Regional Variable)
+	~DiagMat(){};
+
+	//////End of Constrcutors & Destructors
+
+
+
+	//////Content Operation (These Functions Work on Itself)
+
+	//Set Temp Status
+	DiagMat<Type> & SetTemp()
+	{
+		_IsTemp=1;
+		return *this;
+	}
+
+	//Set Return Status
+	DiagMat<Type> & SetReturn()
+	{
+		_IsReturn=1;
+		return *this;
+	}
+
+	//Clean Temp
+	void CleanTmp()
+	{
+		if(_IsTemp&&(!_IsIdentity))
+		{
+#if _HEAPSCOPE
+			MiniMat_HeapScope._HeapMinus(((u32)sizeof(Type))*((u32)_Row));
+#endif
+			free(_Value);
+			_Value=NULL;
+		}
+		return;
+	}
+
+	//Clean Return After Use
+	void CleanRet()
+	{
+		if(_IsReturn&&(!_IsIdentity))
+		{
+#if _HEAPSCOPE
+			MiniMat_HeapScope._HeapMinus(((u32)sizeof(Type))*((u32)_Row));
+#endif
+			free(_Value);
+			_Value=NULL;
+		}
+		return;
+	}
+
+	//Insert Single Diagonal Value (Not Applicable for Identity)
+	DiagMat<Type> & operator()(u8 Idx, Type Value)
+	{
+		*(_Value+Idx-1)=Value;
+		return *this;
+	}
+
+	//Set All Diagonal Elements to Same Value (Not Applicable for Identity)
+	DiagMat<Type> & operator=(Type EqualValue)
+	{
+		Type *_Ptr1=_Value;
+		u8 ii;
+		for(ii=0;ii<_Row;ii++)
+		{
+			*_Ptr1=EqualValue;
+			_Ptr1++;
+		}
+		return *this;
+	}
+
+	//Diagonal Equality(This will destroy Input Diag if is Temp Diag, Not Applicable for Identity)
+	DiagMat<Type> & operator=(DiagMat<Type> EqualDiag)
+	{
+		Type *_Ptr1=_Value;
+		u8 ii;
+		for(ii=0;ii<_Row;ii++)
+		{
+			*_Ptr1=EqualDiag.Val(ii+1);
+			_Ptr1++;
+		}
+
+		EqualDiag.CleanRet();
+
+		return *this;
+	}
+
+	//Copy Diagonal from a Square Matrix (This will destroy Input Mat if is Temp Mat, Not Applicable for Identity)
+	DiagMat<Type> & operator=(Mat<Type> EqualMat)
+	{
+		Type *_Ptr1=_Value;
+		Type *_Ptr2=EqualMat.Pt();
+		u8 ii;
+		for(ii=0;ii<_Row;ii++)
+		{
+			*_Ptr1=*_Ptr2;
+			_Ptr1++;
+			_Ptr2+=EqualMat.Co()+1;
+		}
+
+		EqualMat.CleanRet();
+
+		return *this;
+	}
+
+	//////End of Content operation
+
+
+
+	//////Input/Output Flow (Note: Jumper must be used right after the DiagMat Variable)
+
+	//Inputer (Input)
+	DiagMat<Type> & operator<<(Type SingleValue)
+	{
+		*_IPtr=SingleValue;
+		return *this;
+	}
+
+	//Stepper (Step to the Next Diagonal Element and input)
+	DiagMat<Type> & operator,(Type SingleValue)
+	{
+		_IPtr++;
+		*_IPtr=SingleValue;
+		return *this;
+	}
+
+	//Jumper (Plus to Jump Forward Certain Elements, 0 to First Element)
+	DiagMat<Type> & operator>>(s16 SingleValue)
+	{
+		if(SingleValue==0)
+		{
+			_IPtr=_Value;
+		}
+		else if(SingleValue>0)
+		{
+			_IPtr=_IPtr+SingleValue;
+		}
+		return *this;
+	}
+
+	//Print the Matrix on Console
+#if !_MICROCHIP
+	void Print()
+	{
+		cout<<endl;
+		u8 ii,jj;
+		for(ii=1;ii<=_Row;ii++)
+		{
+			for(jj=1;jj<=_Row;jj++)
+			{
+				if(ii==jj)
+				{
+					cout<<Val(ii)<<"\t";
+				}
+				else
+				{
+					cout<<0<<"\t";
+				}
+			}
+			cout<<endl;
+		}
+	}
+#endif
+	//////End of Input Flow
+
+
+
+	//////Self Interaction (These functions, if correctly used, generates new things)
+
+	//FeedBack RowNum
+	u8 Ro()
+	{
+		return _Row;
+	}
+
+	//FeedBack ColNum
+	u8 Co()
+	{
+		return _Row;
+	}
+
+	//FeedBack Number of Stored Elements
+	u16 Sz()
+	{
+		return (_IsIdentity?0:_Row);
+	}
+
+	//FeedBack Memory Space
+	u32 Sp()
+	{
+		return Sz()*sizeof(Type);
+	}
+
+	//FeedBack Identity Status
+	bool Eye()
+	{
+		return _IsIdentity;
+	}
+
+	//Extract Single Diagonal Value
+	Type Val(u8 Idx)
+	{
+		if(_IsIdentity)
+		{
+			return 1;
+		}
+		return *(_Value+Idx-1);
+	}
+
+	//Expand to Full Matrix
+	Mat<Type> Full()
+	{
+		RetMat(Type,NewMat,_Row,_Row);
+		NewMat=0;
+
+		Type *_Ptr1=NewMat.Pt();
+		u8 ii;
+		for(ii=1;ii<=_Row;ii++)
+		{
+			*_Ptr1=Val(ii);
+			_Ptr1+=_Row+1;
+		}
+
+		return NewMat;
+	}
+
+	//Expand to Full Matrix (This will destroy Operated Diag if it is Temp Diag)
+	friend Mat<Type> Full(DiagMat<Type> CalcDiag)
+	{
+		Mat<Type> NewMat=CalcDiag.Full();
+		CalcDiag.CleanRet();
+		return NewMat;
+	}
+
+	//Calculate Determinant (O(N))
+	Type Det()
+	{
+		Type ProdVal=1;
+		if(!_IsIdentity)
+		{
+			Type *_Ptr1=_Value;
+			u8 ii;
+			for(ii=0;ii<_Row;ii++)
+			{
+				ProdVal*=*_Ptr1;
+				_Ptr1++;
+			}
+		}
+		return ProdVal;
+	}
+
+	//Calculate Determinant (O(N))
+	friend Type Det(DiagMat<Type> CalcDiag)
+	{
+		Type ProdVal=CalcDiag.Det();
+		CalcDiag.CleanRet();
+		return ProdVal;
+	}
+
+	//Calculate Inverse (O(N), Will be wrong if any diagonal element is zero)
+	DiagMat<Type> Inv()
+	{
+		if(_IsIdentity)
+		{
+			return *this;
+		}
+
+		RetDiag(Type,NewDiag,_Row);
+		Type *_Ptr1=_Value;
+		Type *_Ptr2=NewDiag._Value;
+		u8 ii;
+		for(ii=0;ii<_Row;ii++)
+		{
+			*_Ptr2=1/(*_Ptr1);
+			_Ptr1++;
+			_Ptr2++;
+		}
+		return NewDiag;
+	}
+
+	//Calculate Inverse (O(N), This will destroy Operated Diag if it is Temp Diag)
+	DiagMat<Type> operator!()
+	{
+		DiagMat<Type> NewDiag=Inv();
+		CleanRet();
+		return NewDiag;
+	}
+
+	//Calculate Transpose (Diagonal is Symmetric)
+	DiagMat<Type> Trans()
+	{
+		if(_IsIdentity)
+		{
+			return *this;
+		}
+
+		RetDiag(Type,NewDiag,_Row);
+		Type *_Ptr1=_Value;
+		Type *_Ptr2=NewDiag._Value;
+		u8 ii;
+		for(ii=0;ii<_Row;ii++)
+		{
+			*_Ptr2=*_Ptr1;
+			_Ptr1++;
+			_Ptr2++;
+		}
+		return NewDiag;
+	}
+
+	//////End of Self Interaction
+
+
+
+	//////Interaction Between Diagonal Matrixes
+
+	//Calculate Multiply (O(N))
+	friend DiagMat<Type> operator*(DiagMat<Type> CalcDiagL, DiagMat<Type> CalcDiagR)
+	{
+		if(CalcDiagL._IsIdentity&&CalcDiagR._IsIdentity)
+		{
+			return CalcDiagL;
+		}
+
+		RetDiag(Type,NewDiag,CalcDiagL._Row);
+		Type *_Ptr1=NewDiag._Value;
+		u8 ii;
+		for(ii=1;ii<=CalcDiagL._Row;ii++)
+		{
+			*_Ptr1=CalcDiagL.Val(ii)*CalcDiagR.Val(ii);
+			_Ptr1++;
+		}
+
+		CalcDiagL.CleanRet();
+		CalcDiagR.CleanRet();
+
+		return NewDiag;
+	}
+
+	//Calculate Plus (O(N))
+	friend DiagMat<Type> operator+(DiagMat<Type> CalcDiagL, DiagMat<Type> CalcDiagR)
+	{
+		RetDiag(Type,NewDiag,CalcDiagL._Row);
+		Type *_Ptr1=NewDiag._Value;
+		u8 ii;
+		for(ii=1;ii<=CalcDiagL._Row;ii++)
+		{
+			*_Ptr1=CalcDiagL.Val(ii)+CalcDiagR.Val(ii);
+			_Ptr1++;
+		}
+
+		CalcDiagL.CleanRet();
+		CalcDiagR.CleanRet();
+
+		return NewDiag;
+	}
+
+	//Calculate Multiply with Single Value (O(N))
+	friend DiagMat<Type> operator*(DiagMat<Type> CalcDiag, Type CalcValue)
+	{
+		RetDiag(Type,NewDiag,CalcDiag._Row);
+		Type *_Ptr1=NewDiag._Value;
+		u8 ii;
+		for(ii=1;ii<=CalcDiag._Row;ii++)
+		{
+			*_Ptr1=CalcDiag.Val(ii)*CalcValue;
+			_Ptr1++;
+		}
+
+		CalcDiag.CleanRet();
+
+		return NewDiag;
+	}
+
+	//Calculate Multiply with Single Value (O(N))
+	friend DiagMat<Type> operator*(Type CalcValue, DiagMat<Type> CalcDiag)
+	{
+		return CalcDiag*CalcValue;
+	}
+
+	//////End of Interaction Between Diagonal Matrixes
+
+
+
+	//////Interaction with Matrixes
+
+	//Calculate Multiply (Row Scaling, O(N^2))
+	friend Mat<Type> operator*(DiagMat<Type> CalcDiag, Mat<Type> CalcMat)
+	{
+		RetMat(Type,NewMat,CalcMat.Ro(),CalcMat.Co());
+		Type *LPtr=CalcMat.Pt();
+		Type *NPtr=NewMat.Pt();
+		Type Scale;
+		u8 ii,jj;
+		if(CalcDiag._IsIdentity)
+		{
+			NewMat=CalcMat;
+		}
+		else
+		{
+			for(ii=0;ii<CalcMat.Ro();ii++)
+			{
+				Scale=*(CalcDiag._Value+ii);
+				for(jj=0;jj<CalcMat.Co();jj++)
+				{
+					*NPtr=Scale*(*LPtr);
+					LPtr++;
+					NPtr++;
+				}
+			}
+			CalcMat.CleanRet();
+		}
+
+		CalcDiag.CleanRet();
+
+		return NewMat;
+	}
+
+	//Calculate Multiply (Column Scaling, O(N^2))
+	friend Mat<Type> operator*(Mat<Type> CalcMat, DiagMat<Type> CalcDiag)
+	{
+		RetMat(Type,NewMat,CalcMat.Ro(),CalcMat.Co());
+		Type *LPtr=CalcMat.Pt();
+		Type *NPtr=NewMat.Pt();
+		u8 ii,jj;
+		if(CalcDiag._IsIdentity)
+		{
+			NewMat=CalcMat;
+		}
+		else
+		{
+			for(ii=0;ii<CalcMat.Ro();ii++)
+			{
+				for(jj=0;jj<CalcMat.Co();jj++)
+				{
+					*NPtr=(*LPtr)*(*(CalcDiag._Value+jj));
+					LPtr++;
+					NPtr++;
+				}
+			}
+			CalcMat.CleanRet();
+		}
+
+		CalcDiag.CleanRet();
+
+		return NewMat;
+	}
+
+	//Calculate Plus (Only the Diagonal is Touched after Copy, O(N^2))
+	friend Mat<Type> operator+(DiagMat<Type> CalcDiag, Mat<Type> CalcMat)
+	{
+		RetMat(Type,NewMat,CalcMat.Ro(),CalcMat.Co());
+		NewMat=CalcMat;
+
+		Type *NPtr=NewMat.Pt();
+		u8 ii;
+		for(ii=1;ii<=CalcDiag._Row;ii++)
+		{
+			*NPtr+=CalcDiag.Val(ii);
+			NPtr+=CalcDiag._Row+1;
+		}
+
+		CalcDiag.CleanRet();
+
+		return NewMat;
+	}
+
+	//Calculate Plus (Only the Diagonal is Touched after Copy, O(N^2))
+	friend Mat<Type> operator+(Mat<Type> CalcMat, DiagMat<Type> CalcDiag)
+	{
+		return CalcDiag+CalcMat;
+	}
+
+	//Calculate Minus (Only the Diagonal is Touched after Copy, O(N^2))
+	friend Mat<Type> operator-(Mat<Type> CalcMat, DiagMat<Type> CalcDiag)
+	{
+		RetMat(Type,NewMat,CalcMat.Ro(),CalcMat.Co());
+		NewMat=CalcMat;
+
+		Type *NPtr=NewMat.Pt();
+		u8 ii;
+		for(ii=1;ii<=CalcDiag._Row;ii++)
+		{
+			*NPtr-=CalcDiag.Val(ii);
+			NPtr+=CalcDiag._Row+1;
+		}
+
+		CalcDiag.CleanRet();
+
+		return NewMat;
+	}
+
+	//Calculate Minus (O(N^2))
+	friend Mat<Type> operator-(DiagMat<Type> CalcDiag, Mat<Type> CalcMat)
+	{
+		RetMat(Type,NewMat,CalcMat.Ro(),CalcMat.Co());
+		Type *LPtr=CalcMat.Pt();
+		Type *NPtr=NewMat.Pt();
+		u16 ii;
+		for(ii=0;ii<CalcMat.Sz();ii++)
+		{
+			*NPtr=-(*LPtr);
+			LPtr++;
+			NPtr++;
+		}
+
+		NPtr=NewMat.Pt();
+		u8 jj;
+		for(jj=1;jj<=CalcDiag._Row;jj++)
+		{
+			*NPtr+=CalcDiag.Val(jj);
+			NPtr+=CalcDiag._Row+1;
+		}
+
+		CalcMat.CleanRet();
+		CalcDiag.CleanRet();
+
+		return NewMat;
+	}
+
+	//Calculate Inverse Diagonal Multiply (Row Scaling by 1/d, O(N^2), Same as !D*A without the Temp Diag)
+	friend Mat<Type> Solve(DiagMat<Type> CalcDiag, Mat<Type> CalcMat)
+	{
+		RetMat(Type,NewMat,CalcMat.Ro(),CalcMat.Co());
+		Type *LPtr=CalcMat.Pt();
+		Type *NPtr=NewMat.Pt();
+		Type Scale;
+		u8 ii,jj;
+		for(ii=0;ii<CalcMat.Ro();ii++)
+		{
+			Scale=1/CalcDiag.Val(ii+1);
+			for(jj=0;jj<CalcMat.Co();jj++)
+			{
+				*NPtr=Scale*(*LPtr);
+				LPtr++;
+				NPtr++;
+			}
+		}
+
+		CalcMat.CleanRet();
+		CalcDiag.CleanRet();
+
+		return NewMat;
+	}
+
+	//////End of Interaction with Matrixes
+
+};
+
+
+#endif
@@ -0,0 +1,663 @@
+/*
+*File Name: MiniMatFixed.hpp
+*File Creation Date: October 18th 2026
+*File Final Revised Date: October 18th 2026
+*Author: Jiamin Wang
+*Description: Fixed Point Element Types (Q15, Q31) of MiniMat
+*/
+
+/*
+*Note:
+*Q15 and Q31 are signed fractions in [-1,1) which can be used as Mat element types (Mat<Q15>, Mat<Q31>).
+*All arithmetic is integer only: add/sub saturate, multiply rounds to nearest and saturates (-1*-1 gives the maximum).
+*operator* and Point of Mat accumulate through MiniMat_Acc: Q15 products are 32 bits in a 64 bits accumulator,
+*Q31 products are 64 bits shifted to Q48 in a 64 bits accumulator (15 guard bits), rounding only happens once per element.
+*Det and Solve with an extra exponent argument are scaled (block floating point): result = mantissa*2^Exp,
+*so determinants and solutions outside [-1,1) are still represented. Singular systems give 0 mantissas with Exp=0.
+*Floating point conversions (constructor from double, Dbl, Flt) are for setup and printing, not for inner loops.
+*Norm, Inv and other functions using sqrt/fabs of the element type are not supported.
+*/
+
+#ifndef MINIMATFIXED_HPP_
+#define MINIMATFIXED_HPP_
+
+#include "MiniMat.hpp"
+
+#define _QFIX_ONE (((s64) 1)<<30)//1.0 of the Working Format of Scaled Det/Solve
+#define _QFIX_HALF (((s64) 1)<<29)//0.5 of the Working Format of Scaled Det/Solve
+
+
+
+//Storage, Product and Accumulator Types of Fixed Point Formats
+template <u8 Frac>
+
+class QFixTrait;
+
+template <>
+
+class QFixTrait<15>
+{
+public:
+	typedef s16 Raw;//Storage Type
+	typedef s32 Prod;//Product Type
+	typedef s64 Acc;//Accumulator Type
+	enum {AccShift=0};//Right Shift of Products before Accumulation
+};
+
+template <>
+
+class QFixTrait<31>
+{
+public:
+	typedef s32 Raw;//Storage Type
+	typedef s64 Prod;//Product Type
+	typedef s64 Acc;//Accumulator Type
+	enum {AccShift=14};//Right Shift of Products before Accumulation
+};
+
+
+
+template <u8 Frac>
+
+class QFix
+{
+
+public://Types
+
+	typedef typename QFixTrait<Frac>::Raw RawT;
+	typedef typename QFixTrait<Frac>::Prod ProdT;
+	typedef typename QFixTrait<Frac>::Acc AccT;
+
+
+
+protected://Variables (None of the variables can be directly accessed)
+
+	RawT _Raw;//Raw Integer (Value*2^Frac)
+
+	//Saturate a Product Type Value to Raw
+	static RawT _Sat(ProdT Value)
+	{
+		if(Value>((((ProdT) 1)<<Frac)-1))
+		{
+			return (RawT) ((((ProdT) 1)<<Frac)-1);
+		}
+		else if(Value<(-(((ProdT) 1)<<Frac)))
+		{
+			return (RawT) (-(((ProdT) 1)<<Frac));
+		}
+		return (RawT) Value;
+	}
+
+	//Saturate an Accumulator Type Value to Raw
+	static RawT _SatAcc(AccT Value)
+	{
+		if(Value>((((AccT) 1)<<Frac)-1))
+		{
+			return (RawT) ((((AccT) 1)<<Frac)-1);
+		}
+		else if(Value<(-(((AccT) 1)<<Frac)))
+		{
+			return (RawT) (-(((AccT) 1)<<Frac));
+		}
+		return (RawT) Value;
+	}
+
+
+
+public://Functions
+
+	//////Constrcutors & Destructors
+
+	//Zero Constructor
+	QFix():
+	_Raw(0)
+	{};
+
+	//Integer Constructor (Saturated, Only -1 and 0 are Exact)
+	QFix(int Value):
+	_Raw((Value>0)?_Sat(((ProdT) 1)<<Frac):((Value<0)?_Sat(-(((ProdT) 1)<<Frac)):0))
+	{};
+
+	//Floating Point Constructor (Rounded and Saturated)
+	QFix(double Value):
+	_Raw(0)
+	{
+		double Scaled=floor(Value*((double) (((ProdT) 1)<<Frac))+0.5);
+		if(Scaled>=((double) (((ProdT) 1)<<Frac)))
+		{
+			_Raw=_Sat(((ProdT) 1)<<Frac);
+		}
+		else if(Scaled<=(-(double) (((ProdT) 1)<<Frac)))
+		{
+			_Raw=_Sat(-(((ProdT) 1)<<Frac));
+		}
+		else
+		{
+			_Raw=(RawT) Scaled;
+		}
+	};
+
+	//Variable Destructor
+	~QFix(){};
+
+	//Construct from Raw Integer
+	static QFix<Frac> FromRaw(RawT Raw)
+	{
+		QFix<Frac> NewVal;
+		NewVal._Raw=Raw;
+		return NewVal;
+	}
+
+	//Construct from Accumulator (Value*2^Shift, Rounded and Saturated)
+	static QFix<Frac> FromAcc(AccT Value, u8 Shift)
+	{
+		QFix<Frac> NewVal;
+		if(Shift>0)
+		{
+			Value+=((AccT) 1)<<(Shift-1);
+			Value>>=Shift;
+		}
+		NewVal._Raw=_SatAcc(Value);
+		return NewVal;
+	}
+
+	//////End of Constrcutors & Destructors
+
+
+
+	//FeedBack Raw Integer
+	RawT Raw()
+	{
+		return _Raw;
+	}
+
+	//Convert to Double
+	double Dbl()
+	{
+		return ((double) _Raw)/((double) (((ProdT) 1)<<Frac));
+	}
+
+	//Convert to Float
+	float Flt()
+	{
+		return ((float) _Raw)/((float) (((ProdT) 1)<<Frac));
+	}
+
+	//Saturating Plus
+	friend QFix<Frac> operator+(QFix<Frac> ValL, QFix<Frac> ValR)
+	{
+		return FromRaw(_Sat(((ProdT) ValL._Raw)+((ProdT) ValR._Raw)));
+	}
+
+	//Saturating Minus
+	friend QFix<Frac> operator-(QFix<Frac> ValL, QFix<Frac> ValR)
+	{
+		return FromRaw(_Sat(((ProdT) ValL._Raw)-((ProdT) ValR._Raw)));
+	}
+
+	//Rounding Multiply
+	friend QFix<Frac> operator*(QFix<Frac> ValL, QFix<Frac> ValR)
+	{
+		ProdT MultVal=((ProdT) ValL._Raw)*((ProdT) ValR._Raw)+(((ProdT) 1)<<(Frac-1));
+		return FromRaw(_Sat(MultVal>>Frac));
+	}
+
+	//Saturating Devide (Devide by 0 Saturates to the Sign of Numerator)
+	friend QFix<Frac> operator/(QFix<Frac> ValL, QFix<Frac> ValR)
+	{
+		if(ValR._Raw==0)
+		{
+			return FromRaw(_Sat((ValL._Raw<0)?(-(((ProdT) 1)<<Frac)):(((ProdT) 1)<<Frac)));
+		}
+		return FromRaw(_Sat((((ProdT) ValL._Raw)*(((ProdT) 1)<<Frac))/((ProdT) ValR._Raw)));
+	}
+
+	//Saturating Minus Sign
+	QFix<Frac> operator-()
+	{
+		return FromRaw(_Sat(-((ProdT) _Raw)));
+	}
+
+	//Plus Sign
+	QFix<Frac> operator+()
+	{
+		return *this;
+	}
+
+	//Calculate Equal from Plus
+	QFix<Frac> & operator+=(QFix<Frac> CalcVal)
+	{
+		*this=*this+CalcVal;
+		return *this;
+	}
+
+	//Calculate Equal from Minus
+	QFix<Frac> & operator-=(QFix<Frac> CalcVal)
+	{
+		*this=*this-CalcVal;
+		return *this;
+	}
+
+	//Calculate Equal from Multiply
+	QFix<Frac> & operator*=(QFix<Frac> CalcVal)
+	{
+		*this=*this*CalcVal;
+		return *this;
+	}
+
+	//Calculate Equal from Devide
+	QFix<Frac> & operator/=(QFix<Frac> CalcVal)
+	{
+		*this=*this/CalcVal;
+		return *this;
+	}
+
+	//Compare Equal
+	friend bool operator==(QFix<Frac> ValL, QFix<Frac> ValR)
+	{
+		return ValL._Raw==ValR._Raw;
+	}
+
+	//Compare Inequal
+	friend bool operator!=(QFix<Frac> ValL, QFix<Frac> ValR)
+	{
+		return ValL._Raw!=ValR._Raw;
+	}
+
+	//Compare Bigger
+	friend bool operator>(QFix<Frac> ValL, QFix<Frac> ValR)
+	{
+		return ValL._Raw>ValR._Raw;
+	}
+
+	//Compare Smaller
+	friend bool operator<(QFix<Frac> ValL, QFix<Frac> ValR)
+	{
+		return ValL._Raw<ValR._Raw;
+	}
+
+	//Compare No Smaller
+	friend bool operator>=(QFix<Frac> ValL, QFix<Frac> ValR)
+	{
+		return ValL._Raw>=ValR._Raw;
+	}
+
+	//Compare No Bigger
+	friend bool operator<=(QFix<Frac> ValL, QFix<Frac> ValR)
+	{
+		return ValL._Raw<=ValR._Raw;
+	}
+
+#if !_MICROCHIP
+	//Print the Value on Console
+	friend ostream & operator<<(ostream &Out, QFix<Frac> PrintVal)
+	{
+		Out<<PrintVal.Dbl();
+		return Out;
+	}
+#endif
+
+};
+
+typedef QFix<15> Q15;
+typedef QFix<31> Q31;
+
+
+
+//Wide Accumulation of Fixed Point Multiply and Point Product
+template <u8 Frac>
+
+class MiniMat_Acc< QFix<Frac> >
+{
+public:
+	typedef typename QFix<Frac>::AccT Acc;//Accumulator Type
+
+	//Empty Accumulator
+	static Acc Zero()
+	{
+		return 0;
+	}
+
+	//Multiply and Accumulate (Full Product, Optionally Shifted to Leave Guard Bits)
+	static void Mac(Acc &SumVal, QFix<Frac> ValL, QFix<Frac> ValR)
+	{
+		SumVal+=((Acc) (((typename QFix<Frac>::ProdT) ValL.Raw())*((typename QFix<Frac>::ProdT) ValR.Raw())))>>QFixTrait<Frac>::AccShift;
+	}
+
+	//Round and Saturate Accumulator Back to Element Type
+	static QFix<Frac> Out(Acc SumVal)
+	{
+		return QFix<Frac>::FromAcc(SumVal,Frac-QFixTrait<Frac>::AccShift);
+	}
+};
+
+
+
+//Block Floating Point Kernels of Scaled Det/Solve (Working Format: Value=Mantissa/2^30*2^Exp)
+class QFixBlock
+{
+
+public://Functions
+
+	//Arithmetic Right Shift (Negative Shift is Left Shift)
+	static s64 _Shr(s64 Value, s16 Shift)
+	{
+		if(Shift<=0)
+		{
+			return Value*(((s64) 1)<<(-Shift));
+		}
+		else if(Shift>62)
+		{
+			return (Value<0)?-1:0;
+		}
+		return Value>>Shift;
+	}
+
+	//Absolute Value
+	static s64 _Abs(s64 Value)
+	{
+		return (Value<0)?-Value:Value;
+	}
+
+	//Normalize a Row Segment so that the Maximum Magnitude is in [0.5,1) (Return 0 if All Zero)
+	static bool _Norm(s64 *Row, u16 Num, s16 &Exp)
+	{
+		s64 MaxVal=0;
+		s16 Shift=0;
+		u16 jj;
+		for(jj=0;jj<Num;jj++)
+		{
+			if(_Abs(*(Row+jj))>MaxVal)
+			{
+				MaxVal=_Abs(*(Row+jj));
+			}
+		}
+		if(MaxVal==0)
+		{
+			return 0;
+		}
+		while(MaxVal>=_QFIX_ONE)
+		{
+			MaxVal>>=1;
+			Shift++;
+		}
+		while(MaxVal<_QFIX_HALF)
+		{
+			MaxVal<<=1;
+			Shift--;
+		}
+		if(Shift!=0)
+		{
+			for(jj=0;jj<Num;jj++)
+			{
+				*(Row+jj)=_Shr(*(Row+jj),Shift);
+			}
+			Exp+=Shift;
+		}
+		return 1;
+	}
+
+	//Gaussian Elimination with Partial Pivoting on Num x Width Rows (Return Permutation Sign, 0 if Singular)
+	static s8 _Elim(s64 *Work, s16 *Exp, u16 Num, u16 Width)
+	{
+		s8 Sign=1;
+		u16 ii,jj,kk,Piv;
+		s64 BestVal,Mediate,Factor;
+		s64 *KRow,*IRow;
+		s16 BestExp,SwapExp;
+
+		for(ii=0;ii<Num;ii++)
+		{
+			_Norm(Work+((u32) ii)*Width,Width,*(Exp+ii));
+		}
+
+		for(kk=0;kk<Num;kk++)
+		{
+			//Pivot of Largest True Magnitude
+			Piv=kk;
+			BestVal=_Abs(*(Work+((u32) kk)*Width+kk));
+			BestExp=*(Exp+kk);
+			for(ii=kk+1;ii<Num;ii++)
+			{
+				Mediate=_Abs(*(Work+((u32) ii)*Width+kk));
+				if(((*(Exp+ii)>=BestExp)&&(Mediate>_Shr(BestVal,*(Exp+ii)-BestExp)))||((*(Exp+ii)<BestExp)&&(_Shr(Mediate,BestExp-*(Exp+ii))>BestVal)))
+				{
+					Piv=ii;
+					BestVal=Mediate;
+					BestExp=*(Exp+ii);
+				}
+			}
+			if(BestVal==0)
+			{
+				return 0;
+			}
+			if(Piv!=kk)
+			{
+				KRow=Work+((u32) kk)*Width;
+				IRow=Work+((u32) Piv)*Width;
+				for(jj=kk;jj<Width;jj++)
+				{
+					Mediate=*(KRow+jj);
+					*(KRow+jj)=*(IRow+jj);
+					*(IRow+jj)=Mediate;
+				}
+				SwapExp=*(Exp+kk);
+				*(Exp+kk)=*(Exp+Piv);
+				*(Exp+Piv)=SwapExp;
+				Sign=-Sign;
+			}
+
+			//Eliminate (Row Exponents are Aligned so that the Multiplier is within [-1,1])
+			KRow=Work+((u32) kk)*Width;
+			for(ii=kk+1;ii<Num;ii++)
+			{
+				IRow=Work+((u32) ii)*Width;
+				if(*(IRow+kk)==0)
+				{
+					continue;
+				}
+				if(*(Exp+ii)<*(Exp+kk))
+				{
+					for(jj=kk;jj<Width;jj++)
+					{
+						*(IRow+jj)=_Shr(*(IRow+jj),*(Exp+kk)-*(Exp+ii));
+					}
+					*(Exp+ii)=*(Exp+kk);
+				}
+				Factor=((*(IRow+kk))*_QFIX_ONE)/(*(KRow+kk));
+				for(jj=kk+1;jj<Width;jj++)
+				{
+					*(IRow+jj)-=(Factor*(*(KRow+jj)))>>30;
+				}
+				*(IRow+kk)=0;
+				_Norm(IRow+kk+1,Width-kk-1,*(Exp+ii));
+			}
+		}
+
+		return Sign;
+	}
+
+};
+
+
+
+//Calculate Scaled Determinant (Determinant=Mantissa*2^Exp, Destroy Input if is Temp Mat)
+template <u8 Frac>
+
+QFix<Frac> Det(Mat< QFix<Frac> > CalcMat, s16 &Exp)
+{
+	u16 Num=CalcMat.Ro();
+	u32 Byte=((u32) sizeof(s64))*((u32) Num)*((u32) Num)+((u32) sizeof(s16))*((u32) Num);
+	s64 *Work=(s64 *) malloc(Byte);
+#if _HEAPSCOPE
+	MiniMat_HeapScope._HeapPlus(Byte);
+#endif
+	s16 *RowExp=(s16 *) (Work+((u32) Num)*((u32) Num));
+	QFix<Frac> *Value=CalcMat.Pt();
+	u32 ii;
+	u16 kk;
+
+	for(ii=0;ii<((u32) Num)*((u32) Num);ii++)
+	{
+		*(Work+ii)=(s64) (Value+ii)->Raw();
+	}
+	for(kk=0;kk<Num;kk++)
+	{
+		*(RowExp+kk)=30-Frac;
+	}
+	CalcMat.CleanRet();
+
+	s8 Sign=QFixBlock::_Elim(Work,RowExp,Num,Num);
+	s64 Mant=(Sign<0)?-_QFIX_ONE:_QFIX_ONE;
+	s16 DetExp=0;
+	for(kk=0;(kk<Num)&&(Sign!=0);kk++)
+	{
+		Mant=(Mant*(*(Work+((u32) kk)*Num+kk)))>>30;
+		DetExp+=*(RowExp+kk);
+		QFixBlock::_Norm(&Mant,1,DetExp);
+	}
+
+	free(Work);
+#if _HEAPSCOPE
+	MiniMat_HeapScope._HeapMinus(Byte);
+#endif
+
+	if(Sign==0)
+	{
+		Exp=0;
+		return QFix<Frac>(0);
+	}
+	Exp=DetExp;
+	if(Frac>30)
+	{
+		return QFix<Frac>::FromAcc(QFixBlock::_Shr(Mant,30-Frac),0);
+	}
+	return QFix<Frac>::FromAcc(Mant,(u8) (30-Frac));
+}
+
+//Solve A*X=B with Scaled Result (X=Mantissa*2^Exp, Common Exp for All Elements, Destroy Inputs if are Temp Mat)
+template <u8 Frac>
+
+Mat< QFix<Frac> > Solve(Mat< QFix<Frac> > CalcMatA, Mat< QFix<Frac> > CalcMatB, s16 &Exp)
+{
+	u16 Num=CalcMatA.Ro();
+	u16 RhsNum=CalcMatB.Co();
+	u16 Width=Num+RhsNum;
+	RetMat(QFix<Frac>,NewMat,Num,RhsNum);
+	u32 Byte=((u32) sizeof(s64))*((u32) Num)*((u32) Width)+((u32) sizeof(s16))*((u32) Width);
+	s64 *Work=(s64 *) malloc(Byte);
+#if _HEAPSCOPE
+	MiniMat_HeapScope._HeapPlus(Byte);
+#endif
+	s16 *RowExp=(s16 *) (Work+((u32) Num)*((u32) Width));
+	s16 *ColExp=RowExp+Num;
+	QFix<Frac> *ValA=CalcMatA.Pt();
+	QFix<Frac> *ValB=CalcMatB.Pt();
+	u16 ii,jj,kk;
+	s64 *Row;
+
+	for(ii=0;ii<Num;ii++)
+	{
+		Row=Work+((u32) ii)*Width;
+		for(jj=0;jj<Num;jj++)
+		{
+			*(Row+jj)=(s64) (ValA+((u32) ii)*Num+jj)->Raw();
+		}
+		for(jj=0;jj<RhsNum;jj++)
+		{
+			*(Row+Num+jj)=(s64) (ValB+((u32) ii)*RhsNum+jj)->Raw();
+		}
+		*(RowExp+ii)=30-Frac;
+	}
+	CalcMatA.CleanRet();
+	CalcMatB.CleanRet();
+
+	s8 Sign=QFixBlock::_Elim(Work,RowExp,Num,Width);
+	s64 SumVal,Diag,MaxVal;
+	s16 Shift,OutExp=-32767;
+	if(Sign!=0)
+	{
+		//Back Substitution per Column in Units of 2^(ColExp-30), Solution Stored in Place of B
+		for(jj=0;jj<RhsNum;jj++)
+		{
+			*(ColExp+jj)=-30;
+			for(kk=Num;kk>0;kk--)
+			{
+				Row=Work+((u32) kk-1)*Width;
+				Diag=*(Row+kk-1);
+				SumVal=QFixBlock::_Shr(*(Row+Num+jj),*(ColExp+jj));
+				for(ii=kk;ii<Num;ii++)
+				{
+					SumVal-=((*(Row+ii))*(*(Work+((u32) ii)*Width+Num+jj)))>>30;
+				}
+				Shift=0;
+				while(QFixBlock::_Abs(QFixBlock::_Shr(SumVal,Shift))>=2*QFixBlock::_Abs(Diag))
+				{
+					Shift++;
+				}
+				if(Shift>0)
+				{
+					SumVal=QFixBlock::_Shr(SumVal,Shift);
+					for(ii=kk;ii<Num;ii++)
+					{
+						*(Work+((u32) ii)*Width+Num+jj)=QFixBlock::_Shr(*(Work+((u32) ii)*Width+Num+jj),Shift);
+					}
+					*(ColExp+jj)+=Shift;
+				}
+				*(Row+Num+jj)=(SumVal*_QFIX_ONE)/Diag;
+			}
+
+			//Smallest Exponent that Fits this Column in [-1,1)
+			MaxVal=0;
+			for(ii=0;ii<Num;ii++)
+			{
+				if(QFixBlock::_Abs(*(Work+((u32) ii)*Width+Num+jj))>MaxVal)
+				{
+					MaxVal=QFixBlock::_Abs(*(Work+((u32) ii)*Width+Num+jj));
+				}
+			}
+			Shift=*(ColExp+jj)-30;
+			while(MaxVal>0)
+			{
+				MaxVal>>=1;
+				Shift++;
+			}
+			OutExp=(Shift>OutExp)?Shift:OutExp;
+		}
+	}
+
+	QFix<Frac> *Value=NewMat.Pt();
+	for(ii=0;ii<Num;ii++)
+	{
+		for(jj=0;jj<RhsNum;jj++)
+		{
+			if(Sign==0)
+			{
+				*(Value+((u32) ii)*RhsNum+jj)=QFix<Frac>(0);
+			}
+			else
+			{
+				Shift=30-Frac-*(ColExp+jj)+OutExp;
+				if(Shift>0)
+				{
+					*(Value+((u32) ii)*RhsNum+jj)=QFix<Frac>::FromAcc(*(Work+((u32) ii)*Width+Num+jj),(u8) ((Shift>62)?62:Shift));
+				}
+				else
+				{
+					*(Value+((u32) ii)*RhsNum+jj)=QFix<Frac>::FromAcc(QFixBlock::_Shr(*(Work+((u32) ii)*Width+Num+jj),Shift),0);
+				}
+			}
+		}
+	}
+	Exp=(Sign==0)?0:OutExp;
+
+	free(Work);
+#if _HEAPSCOPE
+	MiniMat_HeapScope._HeapMinus(Byte);
+#endif
+
+	return NewMat;
+}
+
+
+#endif
@@ -0,0 +1,461 @@
+/*
+*File Name: MiniMatHalf.hpp
+*File Creation Date: October 18th 2026
+*File Final Revised Date: October 18th 2026
+*Author: Jiamin Wang
+*Description: 16 Bits Floating Point Storage Types (Half, BHalf) of MiniMat
+*/
+
+/*
+*Note:
+*Half (IEEE binary16) and BHalf (bfloat16) are storage types, which can be used as Mat element types (Mat<Half>, Mat<BHalf>).
+*Every arithmetic is done in float and rounded back (nearest even), so element-wise operations are correct but not fast.
+*operator* and Point of Mat<Half>/Mat<BHalf> accumulate in float through MiniMat_Acc.
+*The fast paths keep the matrix in 16 bits and widen blocks of elements to float right before use:
+*	GemvHalf(A,In,Out): Out=A*In with float vectors, MultHalf(A,B): A*B with a float matrix B (result is Mat<float>).
+*Bulk conversions: ToFloat(Mat<Half>) gives Mat<float>, ToHalf<Half>(Mat<float>) or ToHalf<BHalf>(Mat<float>) gives 16 bits.
+*Load/Store convert raw arrays; F16C instructions are used for Half when compiled with them (e.g. -mf16c).
+*/
+
+#ifndef MINIMATHALF_HPP_
+#define MINIMATHALF_HPP_
+
+#include "MiniMat.hpp"
+#include <string.h>
+
+#if defined(__F16C__)
+	#include <immintrin.h>
+#endif
+
+#ifndef _HALF_BLOCK
+	#define _HALF_BLOCK 64//Number of Elements Widened at Once
+#endif
+
+
+
+template <bool IsBrain>
+
+class Flt16
+{
+
+protected://Variables (None of the variables can be directly accessed)
+
+	u16 _Bits;//Raw 16 Bits
+
+
+
+public://Functions
+
+	//////Conversions
+
+	//Float to 16 Bits (Round to Nearest Even)
+	static u16 _Encode(float Value)
+	{
+		_Mat_Bits32 Word;
+		memcpy(&Word,&Value,4);
+		if(IsBrain)
+		{
+			if((Word&0x7fffffff)>0x7f800000)
+			{
+				return (u16) ((Word>>16)|0x40);
+			}
+			return (u16) ((Word+0x7fff+((Word>>16)&1))>>16);
+		}
+
+		u16 Sign=(u16) ((Word>>16)&0x8000);
+		Word&=0x7fffffff;
+		if(Word>=0x7f800000)
+		{
+			return (u16) (Sign|0x7c00|((Word>0x7f800000)?0x200:0));
+		}
+		else if(Word>=0x477ff000)
+		{
+			return (u16) (Sign|0x7c00);
+		}
+		else if(Word<0x38800000)
+		{
+			if(Word<0x33000000)
+			{
+				return Sign;
+			}
+			_Mat_Bits32 Shift=126-(Word>>23);
+			_Mat_Bits32 Mant=(Word&0x7fffff)|0x800000;
+			_Mat_Bits32 Round=((Mant>>Shift)&1)+(((_Mat_Bits32) 1)<<(Shift-1))-1;
+			return (u16) (Sign|((Mant+Round)>>Shift));
+		}
+		return (u16) (Sign|((Word-0x38000000+0xfff+((Word>>13)&1))>>13));
+	}
+
+	//16 Bits to Float
+	static float _Decode(u16 Bits)
+	{
+		_Mat_Bits32 Word;
+		float Value;
+		if(IsBrain)
+		{
+			Word=((_Mat_Bits32) Bits)<<16;
+		}
+		else
+		{
+			_Mat_Bits32 Sign=((_Mat_Bits32) (Bits&0x8000))<<16;
+			_Mat_Bits32 Expo=(Bits>>10)&0x1f;
+			_Mat_Bits32 Mant=Bits&0x3ff;
+			if(Expo==0)
+			{
+				if(Mant==0)
+				{
+					Word=Sign;
+				}
+				else
+				{
+					Expo=113;
+					while(!(Mant&0x400))
+					{
+						Mant<<=1;
+						Expo--;
+					}
+					Word=Sign|(Expo<<23)|((Mant&0x3ff)<<13);
+				}
+			}
+			else if(Expo==31)
+			{
+				Word=Sign|0x7f800000|(Mant<<13)|((Mant!=0)?0x400000:0);
+			}
+			else
+			{
+				Word=Sign|((Expo+112)<<23)|(Mant<<13);
+			}
+		}
+		memcpy(&Value,&Word,4);
+		return Value;
+	}
+
+	//Widen an Array to Float
+	static void Load(const Flt16<IsBrain> *In, float *Out, u32 Num)
+	{
+		u32 ii=0;
+#if defined(__F16C__)
+		if(!IsBrain)
+		{
+			for(;ii+8<=Num;ii+=8)
+			{
+				_mm256_storeu_ps(Out+ii,_mm256_cvtph_ps(_mm_loadu_si128((const __m128i *) (In+ii))));
+			}
+		}
+#endif
+		for(;ii<Num;ii++)
+		{
+			*(Out+ii)=_Decode((In+ii)->_Bits);
+		}
+	}
+
+	//Narrow an Array from Float
+	static void Store(const float *In, Flt16<IsBrain> *Out, u32 Num)
+	{
+		u32 ii=0;
+#if defined(__F16C__)
+		if(!IsBrain)
+		{
+			for(;ii+8<=Num;ii+=8)
+			{
+				_mm_storeu_si128((__m128i *) (Out+ii),_mm256_cvtps_ph(_mm256_loadu_ps(In+ii),_MM_FROUND_TO_NEAREST_INT));
+			}
+		}
+#endif
+		for(;ii<Num;ii++)
+		{
+			(Out+ii)->_Bits=_Encode(*(In+ii));
+		}
+	}
+
+	//////End of Conversions
+
+
+
+	//////Constrcutors & Destructors
+
+	//Zero Constructor
+	Flt16():
+	_Bits(0)
+	{};
+
+	//Float Constructor
+	Flt16(float Value):
+	_Bits(_Encode(Value))
+	{};
+
+	//Double Constructor
+	Flt16(double Value):
+	_Bits(_Encode((float) Value))
+	{};
+
+	//Integer Constructor
+	Flt16(int Value):
+	_Bits(_Encode((float) Value))
+	{};
+
+	//Variable Destructor
+	~Flt16(){};
+
+	//Construct from Raw Bits
+	static Flt16<IsBrain> FromBits(u16 Bits)
+	{
+		Flt16<IsBrain> NewVal;
+		NewVal._Bits=Bits;
+		return NewVal;
+	}
+
+	//////End of Constrcutors & Destructors
+
+
+
+	//FeedBack Raw Bits
+	u16 Bits()
+	{
+		return _Bits;
+	}
+
+	//Convert to Float
+	float Flt()
+	{
+		return _Decode(_Bits);
+	}
+
+	//Calculate Plus
+	friend Flt16<IsBrain> operator+(Flt16<IsBrain> ValL, Flt16<IsBrain> ValR)
+	{
+		return Flt16<IsBrain>(ValL.Flt()+ValR.Flt());
+	}
+
+	//Calculate Minus
+	friend Flt16<IsBrain> operator-(Flt16<IsBrain> ValL, Flt16<IsBrain> ValR)
+	{
+		return Flt16<IsBrain>(ValL.Flt()-ValR.Flt());
+	}
+
+	//Calculate Multiply
+	friend Flt16<IsBrain> operator*(Flt16<IsBrain> ValL, Flt16<IsBrain> ValR)
+	{
+		return Flt16<IsBrain>(ValL.Flt()*ValR.Flt());
+	}
+
+	//Calculate Devide
+	friend Flt16<IsBrain> operator/(Flt16<IsBrain> ValL, Flt16<IsBrain> ValR)
+	{
+		return Flt16<IsBrain>(ValL.Flt()/ValR.Flt());
+	}
+
+	//Minus Sign (Flip Sign Bit)
+	Flt16<IsBrain> operator-()
+	{
+		return FromBits(_Bits^0x8000);
+	}
+
+	//Plus Sign
+	Flt16<IsBrain> operator+()
+	{
+		return *this;
+	}
+
+	//Calculate Equal from Plus
+	Flt16<IsBrain> & operator+=(Flt16<IsBrain> CalcVal)
+	{
+		*this=*this+CalcVal;
+		return *this;
+	}
+
+	//Calculate Equal from Minus
+	Flt16<IsBrain> & operator-=(Flt16<IsBrain> CalcVal)
+	{
+		*this=*this-CalcVal;
+		return *this;
+	}
+
+	//Calculate Equal from Multiply
+	Flt16<IsBrain> & operator*=(Flt16<IsBrain> CalcVal)
+	{
+		*this=*this*CalcVal;
+		return *this;
+	}
+
+	//Calculate Equal from Devide
+	Flt16<IsBrain> & operator/=(Flt16<IsBrain> CalcVal)
+	{
+		*this=*this/CalcVal;
+		return *this;
+	}
+
+	//Compare Equal
+	friend bool operator==(Flt16<IsBrain> ValL, Flt16<IsBrain> ValR)
+	{
+		return ValL.Flt()==ValR.Flt();
+	}
+
+	//Compare Inequal
+	friend bool operator!=(Flt16<IsBrain> ValL, Flt16<IsBrain> ValR)
+	{
+		return ValL.Flt()!=ValR.Flt();
+	}
+
+	//Compare Bigger
+	friend bool operator>(Flt16<IsBrain> ValL, Flt16<IsBrain> ValR)
+	{
+		return ValL.Flt()>ValR.Flt();
+	}
+
+	//Compare Smaller
+	friend bool operator<(Flt16<IsBrain> ValL, Flt16<IsBrain> ValR)
+	{
+		return ValL.Flt()<ValR.Flt();
+	}
+
+	//Compare No Smaller
+	friend bool operator>=(Flt16<IsBrain> ValL, Flt16<IsBrain> ValR)
+	{
+		return ValL.Flt()>=ValR.Flt();
+	}
+
+	//Compare No Bigger
+	friend bool operator<=(Flt16<IsBrain> ValL, Flt16<IsBrain> ValR)
+	{
+		return ValL.Flt()<=ValR.Flt();
+	}
+
+#if !_MICROCHIP
+	//Print the Value on Console
+	friend ostream & operator<<(ostream &Out, Flt16<IsBrain> PrintVal)
+	{
+		Out<<PrintVal.Flt();
+		return Out;
+	}
+#endif
+
+};
+
+typedef Flt16<false> Half;
+typedef Flt16<true> BHalf;
+
+
+
+//Float Accumulation of 16 Bits Multiply and Point Product
+template <bool IsBrain>
+
+class MiniMat_Acc< Flt16<IsBrain> >
+{
+public:
+	typedef float Acc;//Accumulator Type
+
+	//Empty Accumulator
+	static Acc Zero()
+	{
+		return 0;
+	}
+
+	//Multiply and Accumulate
+	static void Mac(Acc &SumVal, Flt16<IsBrain> ValL, Flt16<IsBrain> ValR)
+	{
+		SumVal+=ValL.Flt()*ValR.Flt();
+	}
+
+	//Accumulator Back to Element Type
+	static Flt16<IsBrain> Out(Acc SumVal)
+	{
+		return Flt16<IsBrain>(SumVal);
+	}
+};
+
+
+
+//Widen to a Float Matrix (Destroy Input if is Temp Mat)
+template <bool IsBrain>
+
+Mat<float> ToFloat(Mat< Flt16<IsBrain> > CalcMat)
+{
+	RetMat(float,NewMat,CalcMat.Ro(),CalcMat.Co());
+	Flt16<IsBrain>::Load(CalcMat.Pt(),NewMat.Pt(),CalcMat.Sz());
+	CalcMat.CleanRet();
+	return NewMat;
+}
+
+//Narrow a Float Matrix to 16 Bits, Call as ToHalf<Half> or ToHalf<BHalf> (Destroy Input if is Temp Mat)
+template <class HalfT>
+
+Mat<HalfT> ToHalf(Mat<float> CalcMat)
+{
+	RetMat(HalfT,NewMat,CalcMat.Ro(),CalcMat.Co());
+	HalfT::Store(CalcMat.Pt(),NewMat.Pt(),CalcMat.Sz());
+	CalcMat.CleanRet();
+	return NewMat;
+}
+
+//Calculate Out=A*In with 16 Bits A and Float Vectors (Widen A by Blocks, Destroy A if is Temp Mat)
+template <bool IsBrain>
+
+void GemvHalf(Mat< Flt16<IsBrain> > CalcMat, float *In, float *Out)
+{
+	float Block[_HALF_BLOCK];
+	Flt16<IsBrain> *RowPtr=CalcMat.Pt();
+	float MultSum;
+	u8 ii,jj,kk,Num;
+
+	for(ii=0;ii<CalcMat.Ro();ii++)
+	{
+		MultSum=0;
+		for(jj=0;jj<CalcMat.Co();jj+=Num)
+		{
+			Num=((CalcMat.Co()-jj)<_HALF_BLOCK)?(CalcMat.Co()-jj):_HALF_BLOCK;
+			Flt16<IsBrain>::Load(RowPtr+jj,Block,Num);
+			for(kk=0;kk<Num;kk++)
+			{
+				MultSum+=Block[kk]*(*(In+jj+kk));
+			}
+		}
+		*(Out+ii)=MultSum;
+		RowPtr+=CalcMat.Co();
+	}
+
+	CalcMat.CleanRet();
+}
+
+//Calculate A*B with 16 Bits A and Float B (Widen A by Blocks, Destroy Inputs if are Temp Mat)
+template <bool IsBrain>
+
+Mat<float> MultHalf(Mat< Flt16<IsBrain> > CalcMatL, Mat<float> CalcMatR)
+{
+	RetMat(float,NewMat,CalcMatL.Ro(),CalcMatR.Co());
+	float Block[_HALF_BLOCK];
+	Flt16<IsBrain> *RowPtr=CalcMatL.Pt();
+	float *OPtr=NewMat.Pt();
+	float *RPtr;
+	float Scale;
+	u8 ii,jj,kk,ll,Num,RCol=CalcMatR.Co();
+
+	NewMat=0;
+	for(ii=0;ii<CalcMatL.Ro();ii++)
+	{
+		for(jj=0;jj<CalcMatL.Co();jj+=Num)
+		{
+			Num=((CalcMatL.Co()-jj)<_HALF_BLOCK)?(CalcMatL.Co()-jj):_HALF_BLOCK;
+			Flt16<IsBrain>::Load(RowPtr+jj,Block,Num);
+			for(kk=0;kk<Num;kk++)
+			{
+				Scale=Block[kk];
+				RPtr=CalcMatR.Pt()+((u16) (jj+kk))*RCol;
+				for(ll=0;ll<RCol;ll++)
+				{
+					*(OPtr+ll)+=Scale*(*(RPtr+ll));
+				}
+			}
+		}
+		RowPtr+=CalcMatL.Co();
+		OPtr+=RCol;
+	}
+
+	CalcMatL.CleanRet();
+	CalcMatR.CleanRet();
+
+	return NewMat;
+}
+
+
+#endif
@@ -0,0 +1,734 @@
+/*
+*File Name: MiniMatKrylov.hpp
+*File Creation Date: October 18th 2026
+*File Final Revised Date: October 18th 2026
+*Author: Jiamin Wang
+*Description: Krylov Iterative Solvers (CG, BiCGSTAB, GMRES) and Preconditioners of MiniMat
+*/
+
+/*
+*Note:
+*The solvers only need the matrix vector product, which is given by LinOp (a function pointer with a context pointer).
+*LinOp can wrap Mat, SpMat or any user defined operator (Such as BandMat/TriMat Mult, or a matrix free stencil).
+*CG is for symmetric positive definite systems, BiCGSTAB and GMRES(Restart) are for general systems.
+*Preconditioners (JacobiPre, ICholPre) are also LinOp (they apply the inverse), NULL for no preconditioning.
+*Work vectors are allocated once at the beginning of every solve and released at the end.
+*Every solve returns a KrylovRep (iterations, relative residual, convergence).
+*x holds the initial guess on input and the solution on output.
+*/
+
+#ifndef MINIMATKRYLOV_HPP_
+#define MINIMATKRYLOV_HPP_
+
+#include "MiniMatSparse.hpp"
+
+#ifndef _KRYLOV_RESTART
+	#define _KRYLOV_RESTART 30
+#endif
+
+
+
+template <class Type>
+
+class LinOp
+{
+
+protected://Variables (None of the variables can be directly accessed)
+
+	void (*_Func)(void *Ctx, Type *In, Type *Out);//Operator Function
+	void *_Ctx;//Operator Context
+	u16 _Row;//Number of Rows (Same as Number of Columns)
+
+	//Dense Matrix Vector Multiply
+	static void _MatMult(void *Ctx, Type *In, Type *Out)
+	{
+		Mat<Type> *CalcMat=(Mat<Type> *) Ctx;
+		Type *_Ptr1=CalcMat->Pt();
+		Type MultSum;
+		u8 ii,jj;
+		for(ii=0;ii<CalcMat->Ro();ii++)
+		{
+			MultSum=0;
+			for(jj=0;jj<CalcMat->Co();jj++)
+			{
+				MultSum+=(*_Ptr1)*(*(In+jj));
+				_Ptr1++;
+			}
+			*(Out+ii)=MultSum;
+		}
+	}
+
+	//Sparse Matrix Vector Multiply
+	static void _SpMult(void *Ctx, Type *In, Type *Out)
+	{
+		((SpMat<Type> *) Ctx)->Mult(In,Out);
+	}
+
+
+
+public://Functions
+
+	//////Constrcutors & Destructors
+
+	//User Defined Operator Constructor
+	explicit LinOp(u16 Row, void (*Func)(void *Ctx, Type *In, Type *Out), void *Ctx):
+	_Func(Func),_Ctx(Ctx),_Row(Row)
+	{};
+
+	//Dense Matrix Operator Constructor
+	explicit LinOp(Mat<Type> &CalcMat):
+	_Func(_MatMult),_Ctx((void *) &CalcMat),_Row(CalcMat.Ro())
+	{};
+
+	//Sparse Matrix Operator Constructor
+	explicit LinOp(SpMat<Type> &CalcSp):
+	_Func(_SpMult),_Ctx((void *) &CalcSp),_Row(CalcSp.Ro())
+	{};
+
+	//Variable Destructor (Designed for Regional Variable)
+	~LinOp(){};
+
+	//////End of Constrcutors & Destructors
+
+
+
+	//FeedBack RowNum
+	u16 Ro()
+	{
+		return _Row;
+	}
+
+	//Apply the Operator Out=A*In
+	void Mult(Type *In, Type *Out)
+	{
+		_Func(_Ctx,In,Out);
+	}
+
+};
+
+
+
+template <class Type>
+
+class KrylovRep
+{
+
+public://Variables (Plain Report)
+
+	u16 Iter;//Number of Iterations (Matrix Vector Products of the Outer Loop)
+	Type Res;//Relative Residual Norm ||b-Ax||/||b||
+	bool Conv;//Converged Status
+
+	//Empty Report Constructor
+	explicit KrylovRep():
+	Iter(0),Res(0),Conv(0)
+	{};
+
+#if !_MICROCHIP
+	//Print the Report on Console
+	void Print()
+	{
+		cout<<"Iterations: "<<Iter<<"\t"<<"Relative Residual: "<<Res<<"\t"<<(Conv?"Converged":"Not Converged")<<endl;
+	}
+#endif
+
+};
+
+
+
+template <class Type>
+
+class JacobiPre : public LinOp<Type>
+{
+
+protected://Variables (None of the variables can be directly accessed)
+
+	Type *_InvDiag;//Inverse of Diagonal
+
+	//Apply Inverse of Diagonal
+	static void _Apply(void *Ctx, Type *In, Type *Out)
+	{
+		JacobiPre<Type> *Pre=(JacobiPre<Type> *) Ctx;
+		u16 ii;
+		for(ii=0;ii<Pre->_Row;ii++)
+		{
+			*(Out+ii)=(*(In+ii))*(*(Pre->_InvDiag+ii));
+		}
+	}
+
+
+
+public://Functions
+
+	//Empty Preconditioner Constructor
+	explicit JacobiPre():
+	LinOp<Type>(0,_Apply,NULL),_InvDiag(NULL)
+	{
+		this->_Ctx=(void *) this;
+	};
+
+	//Variable Destructor (Memory is Released by CleanTmp)
+	~JacobiPre(){};
+
+	//Release Memory
+	void CleanTmp()
+	{
+		if(_InvDiag!=NULL)
+		{
+#if _HEAPSCOPE
+			MiniMat_HeapScope._HeapMinus(((u32)sizeof(Type))*((u32)this->_Row));
+#endif
+			free(_InvDiag);
+			_InvDiag=NULL;
+		}
+		return;
+	}
+
+	//Build from Diagonal of a Sparse Matrix (Zero Diagonal is Kept as 1)
+	void Build(SpMat<Type> &CalcSp)
+	{
+		CleanTmp();
+		this->_Row=CalcSp.Ro();
+		_InvDiag=(Type *) malloc(sizeof(Type)*((u32)this->_Row));
+#if _HEAPSCOPE
+		MiniMat_HeapScope._HeapPlus(((u32)sizeof(Type))*((u32)this->_Row));
+#endif
+
+		u16 ii;
+		Type Diag;
+		for(ii=0;ii<this->_Row;ii++)
+		{
+			Diag=CalcSp.Val(ii+1,ii+1);
+			*(_InvDiag+ii)=(Diag!=0)?(1/Diag):1;
+		}
+		return;
+	}
+
+	//Build from Diagonal of a Dense Matrix (Zero Diagonal is Kept as 1)
+	void Build(Mat<Type> &CalcMat)
+	{
+		CleanTmp();
+		this->_Row=CalcMat.Ro();
+		_InvDiag=(Type *) malloc(sizeof(Type)*((u32)this->_Row));
+#if _HEAPSCOPE
+		MiniMat_HeapScope._HeapPlus(((u32)sizeof(Type))*((u32)this->_Row));
+#endif
+
+		u16 ii;
+		Type Diag;
+		for(ii=0;ii<this->_Row;ii++)
+		{
+			Diag=CalcMat.Val(ii+1,ii+1);
+			*(_InvDiag+ii)=(Diag!=0)?(1/Diag):1;
+		}
+		return;
+	}
+
+};
+
+
+
+template <class Type>
+
+class ICholPre : public LinOp<Type>
+{
+
+protected://Variables (None of the variables can be directly accessed)
+
+	u32 *_LPtr;//Row Start of L (Lower Triangle of A by Rows, Diagonal Last)
+	u16 *_LIdx;//Column Index of L
+	Type *_LVal;//Value of L
+	Type *_Y;//Work Vector of Forward Solve
+	u32 _LNz;//Number of Nonzeros of L
+
+	//Apply (L*L')\In
+	static void _Apply(void *Ctx, Type *In, Type *Out)
+	{
+		ICholPre<Type> *Pre=(ICholPre<Type> *) Ctx;
+		u16 ii,Row=Pre->_Row;
+		u32 pp,End;
+		Type MultSum;
+		for(ii=0;ii<Row;ii++)
+		{
+			MultSum=*(In+ii);
+			End=*(Pre->_LPtr+ii+1)-1;
+			for(pp=*(Pre->_LPtr+ii);pp<End;pp++)
+			{
+				MultSum-=(*(Pre->_LVal+pp))*(*(Pre->_Y+*(Pre->_LIdx+pp)));
+			}
+			*(Pre->_Y+ii)=MultSum/(*(Pre->_LVal+End));
+		}
+		for(ii=Row;ii>0;ii--)
+		{
+			End=*(Pre->_LPtr+ii)-1;
+			*(Out+ii-1)=(*(Pre->_Y+ii-1))/(*(Pre->_LVal+End));
+			for(pp=*(Pre->_LPtr+ii-1);pp<End;pp++)
+			{
+				*(Pre->_Y+*(Pre->_LIdx+pp))-=(*(Pre->_LVal+pp))*(*(Out+ii-1));
+			}
+		}
+	}
+
+
+
+public://Functions
+
+	//Empty Preconditioner Constructor
+	explicit ICholPre():
+	LinOp<Type>(0,_Apply,NULL),
+	_LPtr(NULL),_LIdx(NULL),_LVal(NULL),_Y(NULL),_LNz(0)
+	{
+		this->_Ctx=(void *) this;
+	};
+
+	//Variable Destructor (Memory is Released by CleanTmp)
+	~ICholPre(){};
+
+	//Release Memory
+	void CleanTmp()
+	{
+		if(_LPtr!=NULL)
+		{
+#if _HEAPSCOPE
+			MiniMat_HeapScope._HeapMinus(((u32)sizeof(u32))*(((u32)this->_Row)+1)+((u32)(sizeof(u16)+sizeof(Type)))*_LNz+((u32)sizeof(Type))*((u32)this->_Row));
+#endif
+			free(_LPtr);
+			free(_LIdx);
+			free(_LVal);
+			free(_Y);
+			_LPtr=NULL;
+			_LIdx=NULL;
+			_LVal=NULL;
+			_Y=NULL;
+		}
+		return;
+	}
+
+	//Build Incomplete Cholesky IC(0) on the Pattern of the Lower Triangle (Symmetric A, Sorted Lines, Return 0 on Breakdown)
+	bool Build(SpMat<Type> &CalcSp)
+	{
+		CleanTmp();
+		u16 Row=CalcSp.Ro();
+		u32 *APtr=CalcSp.PtrPt();
+		u16 *AIdx=CalcSp.IdxPt();
+		Type *AVal=CalcSp.Pt();
+		u16 ii,kk;
+		u32 pp,qq,rr,Slot;
+		bool HasDiag;
+
+		//Lower Triangle of a Symmetric Matrix is the Same for CSR Rows and CSC Columns
+		_LNz=0;
+		for(ii=0;ii<Row;ii++)
+		{
+			HasDiag=0;
+			for(pp=*(APtr+ii);pp<*(APtr+ii+1);pp++)
+			{
+				if(*(AIdx+pp)<ii)
+				{
+					_LNz++;
+				}
+				HasDiag|=(*(AIdx+pp)==ii);
+			}
+			if(!HasDiag)
+			{
+				return 0;
+			}
+			_LNz++;
+		}
+
+		this->_Row=Row;
+		_LPtr=(u32 *) malloc(sizeof(u32)*(((u32)Row)+1));
+		_LIdx=(u16 *) malloc(sizeof(u16)*_LNz);
+		_LVal=(Type *) malloc(sizeof(Type)*_LNz);
+		_Y=(Type *) malloc(sizeof(Type)*((u32)Row));
+#if _HEAPSCOPE
+		MiniMat_HeapScope._HeapPlus(((u32)sizeof(u32))*(((u32)Row)+1)+((u32)(sizeof(u16)+sizeof(Type)))*_LNz+((u32)sizeof(Type))*((u32)Row));
+#endif
+
+		Type Diag,MultSum;
+		Slot=0;
+		for(ii=0;ii<Row;ii++)
+		{
+			*(_LPtr+ii)=Slot;
+			Diag=0;
+			for(pp=*(APtr+ii);pp<*(APtr+ii+1);pp++)
+			{
+				kk=*(AIdx+pp);
+				if(kk<ii)
+				{
+					//L(i,k)=(A(i,k)-L(i,:)*L(k,:)')/L(k,k) over the Common Pattern before k
+					MultSum=*(AVal+pp);
+					qq=*(_LPtr+ii);
+					rr=*(_LPtr+kk);
+					while((qq<Slot)&&(rr<*(_LPtr+kk+1)-1))
+					{
+						if(*(_LIdx+qq)==*(_LIdx+rr))
+						{
+							MultSum-=(*(_LVal+qq))*(*(_LVal+rr));
+							qq++;
+							rr++;
+						}
+						else if(*(_LIdx+qq)<*(_LIdx+rr))
+						{
+							qq++;
+						}
+						else
+						{
+							rr++;
+						}
+					}
+					*(_LIdx+Slot)=kk;
+					*(_LVal+Slot)=MultSum/(*(_LVal+*(_LPtr+kk+1)-1));
+					Slot++;
+				}
+				else if(kk==ii)
+				{
+					Diag=*(AVal+pp);
+				}
+			}
+			for(qq=*(_LPtr+ii);qq<Slot;qq++)
+			{
+				Diag-=(*(_LVal+qq))*(*(_LVal+qq));
+			}
+			if(Diag<=0)
+			{
+				*(_LPtr+ii+1)=Slot;
+				CleanTmp();
+				return 0;
+			}
+			*(_LIdx+Slot)=ii;
+			*(_LVal+Slot)=sqrt(Diag);
+			Slot++;
+			*(_LPtr+ii+1)=Slot;
+		}
+
+		return 1;
+	}
+
+};
+
+
+
+template <class Type>
+
+class Krylov
+{
+
+protected://Variables (None of the variables can be directly accessed)
+
+	Type _Tol;//Relative Residual Tolerance
+	u16 _MaxIter;//Maximum Iterations
+	u16 _Restart;//Restart Length of GMRES
+
+	//Dot Product
+	static Type _Dot(u16 Num, Type *VecL, Type *VecR)
+	{
+		Type SumVal=0;
+		u16 ii;
+		for(ii=0;ii<Num;ii++)
+		{
+			SumVal+=(*(VecL+ii))*(*(VecR+ii));
+		}
+		return SumVal;
+	}
+
+	//Out=VecL+Scale*VecR
+	static void _Axpy(u16 Num, Type *Out, Type *VecL, Type Scale, Type *VecR)
+	{
+		u16 ii;
+		for(ii=0;ii<Num;ii++)
+		{
+			*(Out+ii)=(*(VecL+ii))+Scale*(*(VecR+ii));
+		}
+	}
+
+	//Vec=Alpha*Vec
+	static void _Scal(u16 Num, Type Alpha, Type *Vec)
+	{
+		u16 ii;
+		for(ii=0;ii<Num;ii++)
+		{
+			*(Vec+ii)*=Alpha;
+		}
+	}
+
+	//Apply Preconditioner or Copy
+	static void _Pre(u16 Num, LinOp<Type> *Pre, Type *In, Type *Out)
+	{
+		if(Pre!=NULL)
+		{
+			Pre->Mult(In,Out);
+		}
+		else
+		{
+			u16 ii;
+			for(ii=0;ii<Num;ii++)
+			{
+				*(Out+ii)=*(In+ii);
+			}
+		}
+	}
+
+	//Allocate Work Vectors in One Block
+	static Type * _Work(u32 Num)
+	{
+#if _HEAPSCOPE
+		MiniMat_HeapScope._HeapPlus(((u32)sizeof(Type))*Num);
+#endif
+		return (Type *) malloc(sizeof(Type)*Num);
+	}
+
+	//Release Work Vectors
+	static void _Release(Type *Work, u32 Num)
+	{
+#if _HEAPSCOPE
+		MiniMat_HeapScope._HeapMinus(((u32)sizeof(Type))*Num);
+#endif
+		free(Work);
+	}
+
+
+
+public://Functions
+
+	//Solver Setting Constructor (Restart of 0 is Taken as 1)
+	explicit Krylov(Type Tol=1e-6, u16 MaxIter=1000, u16 Restart=_KRYLOV_RESTART):
+	_Tol(Tol),_MaxIter(MaxIter),_Restart(Restart>0?Restart:1)
+	{};
+
+	//Variable Destructor (Designed for Regional Variable)
+	~Krylov(){};
+
+	//Preconditioned Conjugate Gradient (Symmetric Positive Definite A and Preconditioner)
+	KrylovRep<Type> CG(LinOp<Type> &A, Type *Rhs, Type *X, LinOp<Type> *Pre=NULL)
+	{
+		KrylovRep<Type> Rep;
+		u16 Num=A.Ro();
+		Type *Work=_Work(((u32)Num)*4);
+		Type *R=Work;
+		Type *Z=R+Num;
+		Type *P=Z+Num;
+		Type *Q=P+Num;
+
+		Type NormB=sqrt(_Dot(Num,Rhs,Rhs));
+		if(NormB==0)
+		{
+			NormB=1;
+		}
+
+		A.Mult(X,Q);
+		_Axpy(Num,R,Rhs,-1,Q);
+		_Pre(Num,Pre,R,Z);
+		_Axpy(Num,P,Z,0,Z);
+		Type Rho=_Dot(Num,R,Z);
+		Type RhoOld,Alpha;
+		Rep.Res=sqrt(_Dot(Num,R,R))/NormB;
+
+		while((Rep.Res>_Tol)&&(Rep.Iter<_MaxIter))
+		{
+			A.Mult(P,Q);
+			Alpha=Rho/_Dot(Num,P,Q);
+			_Axpy(Num,X,X,Alpha,P);
+			_Axpy(Num,R,R,-Alpha,Q);
+			Rep.Iter++;
+			Rep.Res=sqrt(_Dot(Num,R,R))/NormB;
+			if(Rep.Res<=_Tol)
+			{
+				break;
+			}
+			_Pre(Num,Pre,R,Z);
+			RhoOld=Rho;
+			Rho=_Dot(Num,R,Z);
+			_Axpy(Num,P,Z,Rho/RhoOld,P);
+		}
+
+		Rep.Conv=(Rep.Res<=_Tol);
+		_Release(Work,((u32)Num)*4);
+		return Rep;
+	}
+
+	//Right Preconditioned BiCGSTAB (General A)
+	KrylovRep<Type> BiCGSTAB(LinOp<Type> &A, Type *Rhs, Type *X, LinOp<Type> *Pre=NULL)
+	{
+		KrylovRep<Type> Rep;
+		u16 Num=A.Ro();
+		Type *Work=_Work(((u32)Num)*7);
+		Type *R=Work;
+		Type *R0=R+Num;
+		Type *P=R0+Num;
+		Type *V=P+Num;
+		Type *S=V+Num;
+		Type *T=S+Num;
+		Type *Hat=T+Num;
+
+		Type NormB=sqrt(_Dot(Num,Rhs,Rhs));
+		if(NormB==0)
+		{
+			NormB=1;
+		}
+
+		A.Mult(X,V);
+		_Axpy(Num,R,Rhs,-1,V);
+		_Axpy(Num,R0,R,0,R);
+		_Axpy(Num,P,R,0,R);
+		Type Rho=_Dot(Num,R0,R);
+		Type RhoOld,Alpha,Omega,Beta;
+		Rep.Res=sqrt(_Dot(Num,R,R))/NormB;
+
+		while((Rep.Res>_Tol)&&(Rep.Iter<_MaxIter))
+		{
+			if(Rho==0)
+			{
+				break;
+			}
+			_Pre(Num,Pre,P,Hat);
+			A.Mult(Hat,V);
+			Alpha=Rho/_Dot(Num,R0,V);
+			_Axpy(Num,X,X,Alpha,Hat);
+			_Axpy(Num,S,R,-Alpha,V);
+			Rep.Iter++;
+			Rep.Res=sqrt(_Dot(Num,S,S))/NormB;
+			if(Rep.Res<=_Tol)
+			{
+				break;
+			}
+
+			_Pre(Num,Pre,S,Hat);
+			A.Mult(Hat,T);
+			Omega=_Dot(Num,T,S)/_Dot(Num,T,T);
+			_Axpy(Num,X,X,Omega,Hat);
+			_Axpy(Num,R,S,-Omega,T);
+			Rep.Res=sqrt(_Dot(Num,R,R))/NormB;
+			if((Rep.Res<=_Tol)||(Omega==0))
+			{
+				break;
+			}
+
+			RhoOld=Rho;
+			Rho=_Dot(Num,R0,R);
+			Beta=(Rho/RhoOld)*(Alpha/Omega);
+			_Axpy(Num,P,P,-Omega,V);
+			_Axpy(Num,P,R,Beta,P);
+		}
+
+		Rep.Conv=(Rep.Res<=_Tol);
+		_Release(Work,((u32)Num)*7);
+		return Rep;
+	}
+
+	//Right Preconditioned Restarted GMRES (General A)
+	KrylovRep<Type> GMRES(LinOp<Type> &A, Type *Rhs, Type *X, LinOp<Type> *Pre=NULL)
+	{
+		KrylovRep<Type> Rep;
+		u16 Num=A.Ro();
+		u16 Dim=_Restart;
+		u32 WorkNum=((u32)Num)*(Dim+2)+((u32)Dim+1)*Dim+3*((u32)Dim+1);
+		Type *Work=_Work(WorkNum);
+		Type *V=Work;
+		Type *W=V+((u32)Num)*(Dim+1);
+		Type *H=W+Num;
+		Type *Cs=H+((u32)Dim+1)*Dim;
+		Type *Sn=Cs+Dim+1;
+		Type *G=Sn+Dim+1;
+
+		Type NormB=sqrt(_Dot(Num,Rhs,Rhs));
+		if(NormB==0)
+		{
+			NormB=1;
+		}
+
+		u16 ii,jj,kk;
+		Type Beta,Mediate,Denom;
+		Type *Vj;
+
+		A.Mult(X,W);
+		_Axpy(Num,V,Rhs,-1,W);
+		Beta=sqrt(_Dot(Num,V,V));
+		Rep.Res=Beta/NormB;
+
+		while((Rep.Res>_Tol)&&(Rep.Iter<_MaxIter))
+		{
+			_Scal(Num,1/Beta,V);
+			*G=Beta;
+			for(ii=1;ii<=Dim;ii++)
+			{
+				*(G+ii)=0;
+			}
+
+			//Arnoldi Process with Givens Rotations
+			for(jj=0;(jj<Dim)&&(Rep.Iter<_MaxIter);jj++)
+			{
+				Vj=V+((u32)Num)*jj;
+				_Pre(Num,Pre,Vj,W);
+				A.Mult(W,Vj+Num);
+				for(ii=0;ii<=jj;ii++)
+				{
+					Mediate=_Dot(Num,Vj+Num,V+((u32)Num)*ii);
+					*(H+((u32)ii)*Dim+jj)=Mediate;
+					_Axpy(Num,Vj+Num,Vj+Num,-Mediate,V+((u32)Num)*ii);
+				}
+				Mediate=sqrt(_Dot(Num,Vj+Num,Vj+Num));
+				*(H+((u32)jj+1)*Dim+jj)=Mediate;
+				if(Mediate!=0)
+				{
+					_Scal(Num,1/Mediate,Vj+Num);
+				}
+
+				for(ii=0;ii<jj;ii++)
+				{
+					Mediate=(*(Cs+ii))*(*(H+((u32)ii)*Dim+jj))+(*(Sn+ii))*(*(H+((u32)ii+1)*Dim+jj));
+					*(H+((u32)ii+1)*Dim+jj)=-(*(Sn+ii))*(*(H+((u32)ii)*Dim+jj))+(*(Cs+ii))*(*(H+((u32)ii+1)*Dim+jj));
+					*(H+((u32)ii)*Dim+jj)=Mediate;
+				}
+				Denom=sqrt((*(H+((u32)jj)*Dim+jj))*(*(H+((u32)jj)*Dim+jj))+(*(H+((u32)jj+1)*Dim+jj))*(*(H+((u32)jj+1)*Dim+jj)));
+				*(Cs+jj)=(*(H+((u32)jj)*Dim+jj))/Denom;
+				*(Sn+jj)=(*(H+((u32)jj+1)*Dim+jj))/Denom;
+				*(H+((u32)jj)*Dim+jj)=Denom;
+				*(H+((u32)jj+1)*Dim+jj)=0;
+				*(G+jj+1)=-(*(Sn+jj))*(*(G+jj));
+				*(G+jj)=(*(Cs+jj))*(*(G+jj));
+
+				Rep.Iter++;
+				Rep.Res=fabs(*(G+jj+1))/NormB;
+				if(Rep.Res<=_Tol)
+				{
+					jj++;
+					break;
+				}
+			}
+
+			//Solve the Upper Triangular System and Update x+=M\(V*y)
+			for(ii=jj;ii>0;ii--)
+			{
+				Mediate=*(G+ii-1);
+				for(kk=ii;kk<jj;kk++)
+				{
+					Mediate-=(*(H+((u32)ii-1)*Dim+kk))*(*(G+kk));
+				}
+				*(G+ii-1)=Mediate/(*(H+((u32)ii-1)*Dim+ii-1));
+			}
+			_Axpy(Num,W,V,0,V);
+			_Scal(Num,*G,W);
+			for(ii=1;ii<jj;ii++)
+			{
+				_Axpy(Num,W,W,*(G+ii),V+((u32)Num)*ii);
+			}
+			_Pre(Num,Pre,W,V);
+			_Axpy(Num,X,X,1,V);
+
+			//True Residual for Restart
+			A.Mult(X,W);
+			_Axpy(Num,V,Rhs,-1,W);
+			Beta=sqrt(_Dot(Num,V,V));
+			Rep.Res=Beta/NormB;
+		}
+
+		Rep.Conv=(Rep.Res<=_Tol);
+		_Release(Work,WorkNum);
+		return Rep;
+	}
+
+};
+
+
+#endif
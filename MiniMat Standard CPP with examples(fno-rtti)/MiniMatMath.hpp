@@ -0,0 +1,347 @@
+/*
+*File Name: MiniMatMath.hpp
+*File Creation Date: October 18th 2026
+*File Final Revised Date: October 18th 2026
+*Author: Jiamin Wang
+*Description: Element-wise Math Functions (Exp, Log, Sin, Cos, Sqrt, Tanh) of MiniMat
+*/
+
+/*
+*Note:
+*Exp, Log, Sin, Cos, Sqrt and Tanh work on Mat<float> and Mat<double>, and return a new Mat of the same size.
+*The last argument selects the accuracy, the default is _MATH_MODE:
+*	_MATH_ACCURATE: every element goes through the standard library (libm), full accuracy of the type.
+*	_MATH_FAST: range reduction and polynomials without branches or calls, so the loops can be vectorized.
+*	GCC only vectorizes them with -O3 -fno-trapping-math (or -ffast-math, which costs a few float bits of accuracy).
+*Fast mode is accurate to about float precision (relative error near 1e-7, also for double), with these limits:
+*	Exp saturates outside the normal range instead of giving 0 or inf (inf and -inf still give inf and 0), Log of denormals is not exact,
+*	float Sin/Cos keep 1e-7 up to |x| about 1e4 and 1e-6 up to 1e5, double Sin/Cos keep 2e-9 up to 1e9, both give NaN beyond,
+*	Tanh has absolute error near 1e-7, and NaN input gives NaN for every function.
+*Sqrt is the hardware square root in both modes, since it is already exact and vectorized.
+*Same as other friend functions, the input will be destroyed if it is temporary.
+*/
+
+#ifndef MINIMATMATH_HPP_
+#define MINIMATMATH_HPP_
+
+#include "MiniMat.hpp"
+#include <string.h>
+
+#define _MATH_ACCURATE 0//Standard Library per Element
+#define _MATH_FAST 1//Branchless Approximation
+
+#ifndef _MATH_MODE
+	#define _MATH_MODE _MATH_ACCURATE//Default Accuracy
+#endif
+
+
+
+//Bit Layout of Floating Point Types (Only float and double are Defined)
+template <class Type>
+
+class MiniMat_MathBits;
+
+template <>
+
+class MiniMat_MathBits<float>
+{
+public:
+	typedef _Mat_Bits32 Word;//Same Size as float
+	enum {MantBits=23, Bias=127};
+};
+
+template <>
+
+class MiniMat_MathBits<double>
+{
+public:
+	typedef u64 Word;//Same Size as double
+	enum {MantBits=52, Bias=1023};
+};
+
+
+
+//Approximation Kernels (Branchless, Compiled into Vector Selects)
+template <class Type>
+
+class MiniMat_MathKernel
+{
+public:
+	typedef typename MiniMat_MathBits<Type>::Word Word;
+
+	//Round to Nearest Integer (Half Away from Zero, Native int Converts in Vector Registers)
+	static Type _Round(Type Value)
+	{
+		Type Half=(Value<0)?(Type) -0.5:(Type) 0.5;
+		return (Type) ((int) (Value+Half));
+	}
+
+	//2^Num for Integer Valued Num Inside Normal Range
+	static Type _Pow2(Type Num)
+	{
+		Type Value;
+		Word Bits=((Word) ((int) Num+MiniMat_MathBits<Type>::Bias))<<MiniMat_MathBits<Type>::MantBits;
+		memcpy(&Value,&Bits,sizeof(Type));
+		return Value;
+	}
+
+	//Exp: x=n*ln2+r, |r|<=ln2/2, exp(r) by Degree 7 Taylor Polynomial (NaN is Kept, +-inf Gives inf and 0)
+	static Type Exp(Type Value)
+	{
+		const Type High=(Type) (MiniMat_MathBits<Type>::Bias*0.69314718055994531);
+		const Type Low=-(Type) ((MiniMat_MathBits<Type>::Bias-1)*0.69314718055994531);
+		const Type Inf=std::numeric_limits<Type>::infinity();
+		Type Input=Value;
+		Type Num,Rem,Poly,Result;
+
+		Value=(Value>High)?High:Value;
+		Value=(Value<Low)?Low:Value;
+		Value=(Value!=Value)?0:Value;
+		Num=_Round(Value*(Type) 1.4426950408889634);
+		Rem=Value-Num*(Type) 0.693145751953125;
+		Rem=Rem-Num*(Type) 1.4286068202862268e-06;
+		Poly=(Type) (1.0/5040.0);
+		Poly=Poly*Rem+(Type) (1.0/720.0);
+		Poly=Poly*Rem+(Type) (1.0/120.0);
+		Poly=Poly*Rem+(Type) (1.0/24.0);
+		Poly=Poly*Rem+(Type) (1.0/6.0);
+		Poly=Poly*Rem+(Type) 0.5;
+		Poly=Poly*Rem+(Type) 1.0;
+		Poly=Poly*Rem+(Type) 1.0;
+		Result=Poly*_Pow2(Num);
+
+		Result=(Input==Inf)?Inf:Result;
+		Result=(Input==-Inf)?0:Result;
+		Result=(Input!=Input)?Input:Result;
+		return Result;
+	}
+
+	//Log: x=m*2^e, sqrt(1/2)<=m<sqrt(2), log(m)=2*atanh((m-1)/(m+1)) by Odd Series (NaN is Kept, inf Gives inf)
+	static Type Log(Type Value)
+	{
+		const Word MantMask=((Word) 1<<MiniMat_MathBits<Type>::MantBits)-1;
+		const Word OneBits=((Word) MiniMat_MathBits<Type>::Bias)<<MiniMat_MathBits<Type>::MantBits;
+		Word Bits;
+		Type Mant,Num,Frac,Ratio,Square,Poly,Result;
+
+		memcpy(&Bits,&Value,sizeof(Type));
+		Num=(Type) ((int) (Bits>>MiniMat_MathBits<Type>::MantBits)-MiniMat_MathBits<Type>::Bias);
+		Bits=(Bits&MantMask)|OneBits;
+		memcpy(&Mant,&Bits,sizeof(Type));
+		Num=(Mant>(Type) 1.4142135623730951)?(Num+1):Num;
+		Mant=(Mant>(Type) 1.4142135623730951)?(Mant*(Type) 0.5):Mant;
+		Frac=Mant-1;
+		Ratio=Frac/(Frac+2);
+		Square=Ratio*Ratio;
+		Poly=(Type) (1.0/11.0);
+		Poly=Poly*Square+(Type) (1.0/9.0);
+		Poly=Poly*Square+(Type) (1.0/7.0);
+		Poly=Poly*Square+(Type) (1.0/5.0);
+		Poly=Poly*Square+(Type) (1.0/3.0);
+		Poly=Poly*Square+(Type) 1.0;
+		Result=Num*(Type) 0.69314718055994531+2*Ratio*Poly;
+
+		Result=(Value==0)?-std::numeric_limits<Type>::infinity():Result;
+		Result=(Value<0)?std::numeric_limits<Type>::quiet_NaN():Result;
+		Result=(Value==std::numeric_limits<Type>::infinity())?Value:Result;
+		Result=(Value!=Value)?Value:Result;
+		return Result;
+	}
+
+	//Sin Shifted by Quarter Periods: x=n*pi/2+r, |r|<=pi/4, Quadrant (n+Shift)&3 Selects +-sin(r) or +-cos(r)
+	//pi/2 is Split in Three Parts, n*Part1 and n*Part2 are Exact for n below 2^13 (float) or 2^30 (double), NaN beyond Limit
+	static Type _SinQuad(Type Value, int Shift)
+	{
+		const bool IsFloat=(sizeof(Type)==sizeof(float));
+		const Type Limit=IsFloat?(Type) 1e5:(Type) 1e9;
+		const Type Part1=IsFloat?(Type) 1.5703125:(Type) 1.5707962512969971;
+		const Type Part2=IsFloat?(Type) 4.837512969970703125e-04:(Type) 7.5497894158615964e-08;
+		const Type Part3=IsFloat?(Type) 7.549789954891882e-08:(Type) 5.3903028600349985e-15;
+		bool IsValid=((Value<=Limit)&&(Value>=-Limit));
+		Type Num,Rem,Square,SinPoly,CosPoly,Result;
+		int Quad;
+
+		Value=IsValid?Value:0;
+		Num=_Round(Value*(Type) 0.63661977236758134);
+		Rem=Value-Num*Part1;
+		Rem=Rem-Num*Part2;
+		Rem=Rem-Num*Part3;
+		Square=Rem*Rem;
+		SinPoly=(Type) (1.0/362880.0);
+		SinPoly=SinPoly*Square-(Type) (1.0/5040.0);
+		SinPoly=SinPoly*Square+(Type) (1.0/120.0);
+		SinPoly=SinPoly*Square-(Type) (1.0/6.0);
+		SinPoly=Rem+Rem*Square*SinPoly;
+		CosPoly=-(Type) (1.0/3628800.0);
+		CosPoly=CosPoly*Square+(Type) (1.0/40320.0);
+		CosPoly=CosPoly*Square-(Type) (1.0/720.0);
+		CosPoly=CosPoly*Square+(Type) (1.0/24.0);
+		CosPoly=CosPoly*Square-(Type) 0.5;
+		CosPoly=1+Square*CosPoly;
+		Quad=((int) Num+Shift)&3;
+
+		Result=(Quad&1)?CosPoly:SinPoly;
+		Result=(Quad&2)?-Result:Result;
+		Result=IsValid?Result:std::numeric_limits<Type>::quiet_NaN();
+		return Result;
+	}
+
+	//Sin
+	static Type Sin(Type Value)
+	{
+		return _SinQuad(Value,0);
+	}
+
+	//Cos
+	static Type Cos(Type Value)
+	{
+		return _SinQuad(Value,1);
+	}
+
+	//Tanh: Odd Series for |x|<1/8, 1-2/(exp(2x)+1) Otherwise (Exp Saturates for Large |x|)
+	static Type Tanh(Type Value)
+	{
+		Type Square=Value*Value;
+		Type Poly,Result;
+
+		Poly=(Type) (62.0/2835.0);
+		Poly=Poly*Square-(Type) (17.0/315.0);
+		Poly=Poly*Square+(Type) (2.0/15.0);
+		Poly=Poly*Square-(Type) (1.0/3.0);
+		Poly=Value+Value*Square*Poly;
+		Value=(Value>20)?20:Value;
+		Value=(Value<-20)?-20:Value;
+		Result=1-2/(Exp(2*Value)+1);
+
+		return (Square<(Type) 0.015625)?Poly:Result;
+	}
+};
+
+
+
+//Element-wise Function Tables (Fast and Accurate Version of Each Function)
+class _MathExp
+{
+public:
+	template <class Type> static Type Fast(Type Value){return MiniMat_MathKernel<Type>::Exp(Value);}
+	template <class Type> static Type Accurate(Type Value){return std::exp(Value);}
+};
+
+class _MathLog
+{
+public:
+	template <class Type> static Type Fast(Type Value){return MiniMat_MathKernel<Type>::Log(Value);}
+	template <class Type> static Type Accurate(Type Value){return std::log(Value);}
+};
+
+class _MathSin
+{
+public:
+	template <class Type> static Type Fast(Type Value){return MiniMat_MathKernel<Type>::Sin(Value);}
+	template <class Type> static Type Accurate(Type Value){return std::sin(Value);}
+};
+
+class _MathCos
+{
+public:
+	template <class Type> static Type Fast(Type Value){return MiniMat_MathKernel<Type>::Cos(Value);}
+	template <class Type> static Type Accurate(Type Value){return std::cos(Value);}
+};
+
+class _MathSqrt
+{
+public:
+	template <class Type> static Type Fast(Type Value){return std::sqrt(Value);}
+	template <class Type> static Type Accurate(Type Value){return std::sqrt(Value);}
+};
+
+class _MathTanh
+{
+public:
+	template <class Type> static Type Fast(Type Value){return MiniMat_MathKernel<Type>::Tanh(Value);}
+	template <class Type> static Type Accurate(Type Value){return std::tanh(Value);}
+};
+
+
+
+//Apply Function Element-wise (Separate Loops so the Fast One is Free of Calls, Destroy Input if is Temp Mat)
+template <class Func, class Type>
+
+Mat<Type> _MathApply(Mat<Type> CalcMat, u8 Mode)
+{
+	RetMat(Type,NewMat,CalcMat.Ro(),CalcMat.Co());
+	Type *InPtr=CalcMat.Pt();
+	Type *OutPtr=NewMat.Pt();
+	u16 Num=CalcMat.Sz();
+	u16 ii;
+
+	if(Mode==_MATH_FAST)
+	{
+		for (ii=0;ii<Num;ii++)
+		{
+			*(OutPtr+ii)=Func::Fast(*(InPtr+ii));
+		}
+	}
+	else
+	{
+		for (ii=0;ii<Num;ii++)
+		{
+			*(OutPtr+ii)=Func::Accurate(*(InPtr+ii));
+		}
+	}
+
+	CalcMat.CleanRet();
+
+	return NewMat;
+}
+
+//Calculate Exponential of All Elements
+template <class Type>
+
+Mat<Type> Exp(Mat<Type> CalcMat, u8 Mode=_MATH_MODE)
+{
+	return _MathApply<_MathExp,Type>(CalcMat,Mode);
+}
+
+//Calculate Natural Logarithm of All Elements
+template <class Type>
+
+Mat<Type> Log(Mat<Type> CalcMat, u8 Mode=_MATH_MODE)
+{
+	return _MathApply<_MathLog,Type>(CalcMat,Mode);
+}
+
+//Calculate Sine of All Elements
+template <class Type>
+
+Mat<Type> Sin(Mat<Type> CalcMat, u8 Mode=_MATH_MODE)
+{
+	return _MathApply<_MathSin,Type>(CalcMat,Mode);
+}
+
+//Calculate Cosine of All Elements
+template <class Type>
+
+Mat<Type> Cos(Mat<Type> CalcMat, u8 Mode=_MATH_MODE)
+{
+	return _MathApply<_MathCos,Type>(CalcMat,Mode);
+}
+
+//Calculate Square Root of All Elements
+template <class Type>
+
+Mat<Type> Sqrt(Mat<Type> CalcMat, u8 Mode=_MATH_MODE)
+{
+	return _MathApply<_MathSqrt,Type>(CalcMat,Mode);
+}
+
+//Calculate Hyperbolic Tangent of All Elements
+template <class Type>
+
+Mat<Type> Tanh(Mat<Type> CalcMat, u8 Mode=_MATH_MODE)
+{
+	return _MathApply<_MathTanh,Type>(CalcMat,Mode);
+}
+
+
+#endif
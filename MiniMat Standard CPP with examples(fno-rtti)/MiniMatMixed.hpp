@@ -0,0 +1,105 @@
+/*
+*File Name: MiniMatMixed.hpp
+*File Creation Date: October 18th 2026
+*File Final Revised Date: October 18th 2026
+*Author: Jiamin Wang
+*Description: Mixed Precision Multiply and Point Product of MiniMat
+*/
+
+/*
+*Note:
+*The matrices keep their narrow storage type, while products are accumulated in a wider type chosen by the caller.
+*MultWide<OutT>(L,R) and PointWide<OutT>(L,R) accumulate in the result type, for examples:
+*	MultWide<s32>(Mat<s8>,Mat<s8>), MultWide<s64>(Mat<s16>,Mat<s16>), PointWide<double>(Mat<float>,Mat<float>).
+*MultAcc<OutT,AccT>(L,R) and PointAcc<OutT,AccT>(L,R) accumulate in AccT and convert once per element.
+*Each element is converted to the accumulator type before the multiply, so narrow products never overflow.
+*Same as operator* and Point, the inputs will be destroyed if they are temporary.
+*/
+
+#ifndef MINIMATMIXED_HPP_
+#define MINIMATMIXED_HPP_
+
+#include "MiniMat.hpp"
+
+
+
+//Calculate Multiply with Accumulation in AccT and Result in OutT (Destroy Inputs if are Temp Mat)
+template <class OutT, class AccT, class Type>
+
+Mat<OutT> MultAcc(Mat<Type> CalcMatL, Mat<Type> CalcMatR)
+{
+	RetMat(OutT,NewMat,CalcMatL.Ro(),CalcMatR.Co());
+	Type *LPtr,*RPtr;
+	Type *LRow=CalcMatL.Pt();
+	OutT *OPtr=NewMat.Pt();
+	AccT MultSum;
+	u8 ii,jj,kk;
+	u8 Inner=CalcMatL.Co();
+	u8 RCol=CalcMatR.Co();
+
+	for (ii=0;ii<CalcMatL.Ro();ii++)
+	{
+		for (jj=0;jj<RCol;jj++)
+		{
+			LPtr=LRow;
+			RPtr=CalcMatR.Pt()+jj;
+			MultSum=0;
+			for (kk=0;kk<Inner;kk++)
+			{
+				MultSum+=((AccT) (*LPtr))*((AccT) (*RPtr));
+				LPtr++;
+				RPtr+=RCol;
+			}
+			*OPtr=(OutT) MultSum;
+			OPtr++;
+		}
+		LRow+=Inner;
+	}
+
+	CalcMatL.CleanRet();
+	CalcMatR.CleanRet();
+
+	return NewMat;
+}
+
+//Calculate Multiply with Accumulation and Result in OutT (Destroy Inputs if are Temp Mat)
+template <class OutT, class Type>
+
+Mat<OutT> MultWide(Mat<Type> CalcMatL, Mat<Type> CalcMatR)
+{
+	return MultAcc<OutT,OutT,Type>(CalcMatL,CalcMatR);
+}
+
+//Calculate Point Product with Accumulation in AccT and Result in OutT (Destroy Inputs if are Temp Mat)
+template <class OutT, class AccT, class Type>
+
+OutT PointAcc(Mat<Type> CalcMatL, Mat<Type> CalcMatR)
+{
+	AccT SumVal=0;
+	Type *LPtr=CalcMatL.Pt();
+	Type *RPtr=CalcMatR.Pt();
+	u16 ii;
+
+	for (ii=0;ii<CalcMatL.Sz();ii++)
+	{
+		SumVal+=((AccT) (*LPtr))*((AccT) (*RPtr));
+		LPtr++;
+		RPtr++;
+	}
+
+	CalcMatL.CleanRet();
+	CalcMatR.CleanRet();
+
+	return (OutT) SumVal;
+}
+
+//Calculate Point Product with Accumulation and Result in OutT (Destroy Inputs if are Temp Mat)
+template <class OutT, class Type>
+
+OutT PointWide(Mat<Type> CalcMatL, Mat<Type> CalcMatR)
+{
+	return PointAcc<OutT,OutT,Type>(CalcMatL,CalcMatR);
+}
+
+
+#endif
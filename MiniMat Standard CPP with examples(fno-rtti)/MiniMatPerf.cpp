@@ -0,0 +1,536 @@
+/*
+*File Name: MiniMatPerf.cpp
+*File Creation Date: October 18th 2026
+*File Final Revised Date: October 18th 2026
+*Author: Jiamin Wang
+*Description: Performance Regression Check of MiniMat
+*/
+
+/*
+*Note:
+*Standalone check (its own main, do not link with Main.cpp), build and run on a desktop:
+*	g++ -std=c++98 -O2 -falign-loops=32 -fno-rtti MiniMatPerf.cpp MiniMat.cpp -o MiniMatPerf
+*	./MiniMatPerf                 Compare against MiniMatPerf.txt, exit 1 if any case is slower (2 if only unstable ones are)
+*	./MiniMatPerf -update         Measure and write MiniMatPerf.txt (commit it as the new baseline, each case keeps the median of 1+retry measurements)
+*Options: -base File, -samples N (default 15), -warmup N (default 3), -sample ms (default 2), -tol % (default 20), -sigma K (default 3),
+*	-retry N (default 2), -drift % (default 10).
+*Every case is run warmup times, then timed as samples of enough repetitions to last the sample time.
+*Right before each sample a fixed scalar loop is timed as reference, and the sample is kept as the ratio of both,
+*so changes of clock speed or load during and between runs mostly cancel out.
+*The median and MAD (median absolute deviation) of the ratios are kept, since they are robust to interrupts.
+*A case is flagged if its ratio is both tol percent and sigma noise widths (1.4826*MAD, larger of the two runs) above the baseline.
+*Flagged cases are measured again retry times after the whole pass, and a case regresses only if every round flags it again ("noise" otherwise).
+*If the reference time of a failing case is off the baseline by more than drift percent, the machine runs at another speed than when the
+*	baseline was taken and the ratio does not fully cancel it, so the case is shown as "unstable" and the run exits 2 instead of 1.
+*Expected false positives, measured with an unchanged build on a shared one core VM (a noisy host): right after -update about 5% of cases
+*	are flagged in the first pass and the retries cleared all of them (0 failing runs out of 20); against a baseline taken minutes earlier
+*	under other host load, 3 of 15 runs still failed, so refresh the baseline on the same idle machine right before comparing.
+*Slowdowns smaller than about sigma noise widths of a case are not reported: an injected 43% slowdown was found in 6 of 8 runs
+*	for a case of 2% MAD, and not at all for Mult 16x16 whose MAD on that VM was 15%.
+*-falign-loops=32 starts every loop on a 32 byte fetch block. Without it a hot loop lands wherever unrelated code leaves it,
+*	and a Mult 16x16 inner loop that straddles a block boundary ran 30 to 35% slower with byte identical instructions:
+*	adding the tracker branch to _HeapPlus moved it across one, and reordering template functions shifted other cases.
+*Baselines depend on the machine, compiler and flags, refresh them with -update after changing any of them.
+*/
+
+#include "MiniMat.hpp"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef _PERF_CASE_MAX
+	#define _PERF_CASE_MAX 64//Maximum Number of Cases in a Baseline
+#endif
+
+#ifndef _PERF_SAMPLE_MAX
+	#define _PERF_SAMPLE_MAX 101//Maximum Number of Samples per Case
+#endif
+
+#ifndef _PERF_PASS_MAX
+	#define _PERF_PASS_MAX 9//Maximum Number of Measurements of a Case for the Baseline
+#endif
+
+
+
+//Operands of One Case (Storage Owned Here)
+template <class Type>
+
+class PerfCase
+{
+public:
+	Mat<Type> A;//N x N Input
+	Mat<Type> B;//N x N Input
+	Mat<Type> C;//N x N Output
+	Mat<Type> Vec;//N x 1 Input
+	Mat<Type> Out;//N x 1 Output
+	Mat<bool> Mask;//N x N Output of Comparisons
+	Type Sink;//Scalar Output
+
+	explicit PerfCase(u8 Size, Type *Buffer, bool *MaskBuffer):
+	A(Size,Size,Buffer),B(Size,Size,Buffer+Size*Size),C(Size,Size,Buffer+2*Size*Size),
+	Vec(Size,1,Buffer+3*Size*Size),Out(Size,1,Buffer+3*Size*Size+Size),Mask(Size,Size,MaskBuffer),Sink(0)
+	{
+		u16 ii;
+		for (ii=0;ii<A.Sz();ii++)
+		{
+			*(A.Pt()+ii)=(Type) ((ii*7)%13)-(Type) 6;
+			*(B.Pt()+ii)=(Type) ((ii*5)%11)-(Type) 5;
+		}
+		for (ii=0;ii<Size;ii++)
+		{
+			*(A.Pt()+ii*Size+ii)=(Type) (4*Size);
+			*(Vec.Pt()+ii)=(Type) (ii%5)-(Type) 2;
+		}
+	};
+
+	//Number of Type Elements Needed by the Constructor
+	static u32 Need(u8 Size)
+	{
+		return 3*((u32) Size)*Size+2*((u32) Size);
+	}
+};
+
+template <class Type> void PerfMult(PerfCase<Type> &Case){Case.C=Case.A*Case.B;}
+template <class Type> void PerfGemv(PerfCase<Type> &Case){Case.Out=Case.A*Case.Vec;}
+template <class Type> void PerfPlus(PerfCase<Type> &Case){Case.C=Case.A+Case.B;}
+template <class Type> void PerfTrans(PerfCase<Type> &Case){Case.C=~Case.A;}
+template <class Type> void PerfDet(PerfCase<Type> &Case){Case.Sink=Det(Case.A);}
+template <class Type> void PerfInv(PerfCase<Type> &Case){Case.C=Case.A.Inv();}
+template <class Type> void PerfPoint(PerfCase<Type> &Case){Case.Sink=Point(Case.A,Case.B);}
+template <class Type> void PerfSum(PerfCase<Type> &Case){Case.Sink=Sum(Case.A);}
+template <class Type> void PerfBigger(PerfCase<Type> &Case){Case.Mask=(Case.A>Case.B);}
+
+
+
+//Settings of a Run
+class PerfSet
+{
+public:
+	u16 Samples;
+	u16 Warmup;
+	double SampleTime;//ns
+	double Tol;//Relative
+	double Sigma;//Noise Widths
+	u16 Retry;//Fresh Measurements a Flagged Case Must Fail Again
+	double Drift;//Relative Change of Reference Time that Makes a Comparison Unstable
+
+	explicit PerfSet():Samples(15),Warmup(3),SampleTime(2e6),Tol(0.2),Sigma(3),Retry(2),Drift(0.1){};
+};
+
+//Result of One Case
+class PerfStat
+{
+public:
+	char Op[16];
+	char TypeName[8];
+	u16 Size;
+	double Median;//ns per Operation (Shown Only)
+	double Ratio;//Median of Operation Time over Reference Iteration Time
+	double Mad;//MAD of Ratio
+};
+
+
+//Monotonic Time in ns
+double PerfNow()
+{
+#if defined(CLOCK_MONOTONIC)
+	timespec Now;
+	clock_gettime(CLOCK_MONOTONIC,&Now);
+	return ((double) Now.tv_sec)*1e9+((double) Now.tv_nsec);
+#else
+	return ((double) clock())*(1e9/CLOCKS_PER_SEC);
+#endif
+}
+
+//Reference Workload (Dependent Scalar Chain, Independent of MiniMat), Return Time in ns
+double PerfRef(u32 Num)
+{
+	volatile double Seed=1.0;
+	double Value=Seed;
+	double Start=PerfNow();
+	u32 ii;
+
+	for (ii=0;ii<Num;ii++)
+	{
+		Value=Value*0.999999+1e-6;
+	}
+	Seed=Value;
+
+	return PerfNow()-Start;
+}
+
+//Median of an Array (Sorted in Place)
+double PerfMedian(double *Value, u16 Num)
+{
+	u16 ii,jj;
+	double Mediate;
+
+	for (ii=1;ii<Num;ii++)
+	{
+		Mediate=*(Value+ii);
+		for (jj=ii;(jj>0)&&(*(Value+jj-1)>Mediate);jj--)
+		{
+			*(Value+jj)=*(Value+jj-1);
+		}
+		*(Value+jj)=Mediate;
+	}
+
+	return ((Num%2)==1)?(*(Value+Num/2)):(0.5*(*(Value+Num/2-1)+*(Value+Num/2)));
+}
+
+//Time One Case (Warm-up, Calibrate Repetitions to the Sample Time, then Median and MAD of Samples)
+template <class Type>
+
+PerfStat PerfRun(const PerfSet &Set, const char *Op, void (*Run)(PerfCase<Type> &Case), const char *TypeName, u8 Size)
+{
+	Type *Buffer=(Type *) malloc(sizeof(Type)*PerfCase<Type>::Need(Size));
+	bool *MaskBuffer=(bool *) malloc(sizeof(bool)*((u32) Size)*Size);
+	PerfCase<Type> Case(Size,Buffer,MaskBuffer);
+	double Sample[_PERF_SAMPLE_MAX];
+	double Ratio[_PERF_SAMPLE_MAX];
+	double Start,Elapsed,RefTime;
+	u32 RefNum=(u32) (Set.SampleTime/4);
+	u32 Reps,ii;
+	u16 Num=(Set.Samples>_PERF_SAMPLE_MAX)?_PERF_SAMPLE_MAX:Set.Samples;
+	u16 kk;
+	PerfStat Stat;
+
+	for (kk=0;kk<Set.Warmup;kk++)
+	{
+		Run(Case);
+	}
+
+	Reps=1;
+	while(1)
+	{
+		Start=PerfNow();
+		for (ii=0;ii<Reps;ii++)
+		{
+			Run(Case);
+		}
+		Elapsed=PerfNow()-Start;
+		if((Elapsed>=Set.SampleTime)||(Reps>=(1UL<<30)))
+		{
+			break;
+		}
+		Reps*=2;
+	}
+
+	for (kk=0;kk<Num;kk++)
+	{
+		RefTime=PerfRef(RefNum)/RefNum;
+		Start=PerfNow();
+		for (ii=0;ii<Reps;ii++)
+		{
+			Run(Case);
+		}
+		Sample[kk]=(PerfNow()-Start)/Reps;
+		Ratio[kk]=Sample[kk]/RefTime;
+	}
+
+	strncpy(Stat.Op,Op,sizeof(Stat.Op)-1);
+	Stat.Op[sizeof(Stat.Op)-1]=0;
+	strncpy(Stat.TypeName,TypeName,sizeof(Stat.TypeName)-1);
+	Stat.TypeName[sizeof(Stat.TypeName)-1]=0;
+	Stat.Size=Size;
+	Stat.Median=PerfMedian(Sample,Num);
+	Stat.Ratio=PerfMedian(Ratio,Num);
+	for (kk=0;kk<Num;kk++)
+	{
+		Ratio[kk]=fabs(Ratio[kk]-Stat.Ratio);
+	}
+	Stat.Mad=PerfMedian(Ratio,Num);
+
+	free(Buffer);
+	free(MaskBuffer);
+
+	return Stat;
+}
+
+//Time One Case if It is Selected (Only is NULL for All Cases), Return Number of Results Written
+template <class Type>
+
+u16 PerfPick(const PerfSet &Set, const char *Op, void (*Run)(PerfCase<Type> &Case), const char *TypeName, u8 Size, const PerfStat *Only, PerfStat *Stat)
+{
+	if((Only!=NULL)&&((strcmp(Op,Only->Op)!=0)||(Size!=Only->Size)))
+	{
+		return 0;
+	}
+	*Stat=PerfRun<Type>(Set,Op,Run,TypeName,Size);
+	return 1;
+}
+
+//Run All Cases of One Type (or Only the Case Matching Op and Size of Only)
+template <class Type>
+
+u16 PerfType(const PerfSet &Set, const char *TypeName, PerfStat *Stat, const PerfStat *Only=NULL)
+{
+	u16 Num=0;
+
+	Num+=PerfPick<Type>(Set,"Mult",PerfMult<Type>,TypeName,4,Only,Stat+Num);
+	Num+=PerfPick<Type>(Set,"Mult",PerfMult<Type>,TypeName,16,Only,Stat+Num);
+	Num+=PerfPick<Type>(Set,"Mult",PerfMult<Type>,TypeName,64,Only,Stat+Num);
+	Num+=PerfPick<Type>(Set,"Gemv",PerfGemv<Type>,TypeName,64,Only,Stat+Num);
+	Num+=PerfPick<Type>(Set,"Plus",PerfPlus<Type>,TypeName,64,Only,Stat+Num);
+	Num+=PerfPick<Type>(Set,"Trans",PerfTrans<Type>,TypeName,64,Only,Stat+Num);
+	Num+=PerfPick<Type>(Set,"Det",PerfDet<Type>,TypeName,4,Only,Stat+Num);
+	Num+=PerfPick<Type>(Set,"Det",PerfDet<Type>,TypeName,6,Only,Stat+Num);
+	Num+=PerfPick<Type>(Set,"Inv",PerfInv<Type>,TypeName,3,Only,Stat+Num);
+	Num+=PerfPick<Type>(Set,"Inv",PerfInv<Type>,TypeName,5,Only,Stat+Num);
+	Num+=PerfPick<Type>(Set,"Point",PerfPoint<Type>,TypeName,64,Only,Stat+Num);
+	Num+=PerfPick<Type>(Set,"Sum",PerfSum<Type>,TypeName,64,Only,Stat+Num);
+	Num+=PerfPick<Type>(Set,"Bigger",PerfBigger<Type>,TypeName,64,Only,Stat+Num);
+
+	return Num;
+}
+
+//Measure One Case Again (Same Op, Type and Size), Return 0 if the Case is Unknown
+bool PerfAgain(const PerfSet &Set, const PerfStat &Only, PerfStat &Stat)
+{
+	if(strcmp(Only.TypeName,"float")==0)
+	{
+		return PerfType<float>(Set,"float",&Stat,&Only)==1;
+	}
+	if(strcmp(Only.TypeName,"double")==0)
+	{
+		return PerfType<double>(Set,"double",&Stat,&Only)==1;
+	}
+	return 0;
+}
+
+//Read Baseline File (Lines of "Op Type Size Median Ratio Mad", # for Comments), Return Number of Cases or -1
+s16 PerfLoad(const char *Name, PerfStat *Stat)
+{
+	FILE *File=fopen(Name,"r");
+	char Line[128];
+	s16 Num=0;
+	unsigned Size;
+
+	if(File==NULL)
+	{
+		return -1;
+	}
+	while((Num<_PERF_CASE_MAX)&&(fgets(Line,sizeof(Line),File)!=NULL))
+	{
+		if((Line[0]=='#')||(Line[0]=='\n')||(Line[0]=='\r'))
+		{
+			continue;
+		}
+		if(sscanf(Line,"%15s %7s %u %lf %lf %lf",Stat[Num].Op,Stat[Num].TypeName,&Size,&Stat[Num].Median,&Stat[Num].Ratio,&Stat[Num].Mad)==6)
+		{
+			Stat[Num].Size=(u16) Size;
+			Num++;
+		}
+	}
+	fclose(File);
+
+	return Num;
+}
+
+//Write Baseline File
+bool PerfSave(const char *Name, const PerfStat *Stat, u16 Num)
+{
+	FILE *File=fopen(Name,"w");
+	u16 ii;
+
+	if(File==NULL)
+	{
+		return 0;
+	}
+	fprintf(File,"# MiniMatPerf baseline, regenerate with: ./MiniMatPerf -update\n");
+	fprintf(File,"# op type size median_ns ratio ratio_mad (ratio: operation time over reference iteration time)\n");
+	for (ii=0;ii<Num;ii++)
+	{
+		fprintf(File,"%s %s %u %.2f %.4f %.4f\n",Stat[ii].Op,Stat[ii].TypeName,(unsigned) Stat[ii].Size,Stat[ii].Median,Stat[ii].Ratio,Stat[ii].Mad);
+	}
+	fclose(File);
+
+	return 1;
+}
+
+//Index of the Same Case in Baseline, or -1
+s16 PerfFind(const PerfStat &Stat, const PerfStat *Base, s16 BaseNum)
+{
+	s16 ii;
+
+	for (ii=0;ii<BaseNum;ii++)
+	{
+		if((strcmp(Stat.Op,(Base+ii)->Op)==0)&&(strcmp(Stat.TypeName,(Base+ii)->TypeName)==0)&&(Stat.Size==(Base+ii)->Size))
+		{
+			return ii;
+		}
+	}
+
+	return -1;
+}
+
+//Measure a Case retry More Times and Keep the Measurement of Median Ratio (Used for Baselines)
+void PerfSteady(const PerfSet &Set, PerfStat &Stat)
+{
+	PerfStat Pass[_PERF_PASS_MAX];
+	PerfStat Mediate;
+	u16 Num=1;
+	u16 ii,jj;
+
+	Pass[0]=Stat;
+	while((Num<_PERF_PASS_MAX)&&(Num<=Set.Retry)&&PerfAgain(Set,Stat,Pass[Num]))
+	{
+		Num++;
+	}
+	for (ii=1;ii<Num;ii++)
+	{
+		Mediate=Pass[ii];
+		for (jj=ii;(jj>0)&&(Pass[jj-1].Ratio>Mediate.Ratio);jj--)
+		{
+			Pass[jj]=Pass[jj-1];
+		}
+		Pass[jj]=Mediate;
+	}
+	Stat=Pass[Num/2];
+	return;
+}
+
+//Slower than Baseline by More than Both Relative Tolerance and Noise
+bool PerfSlow(const PerfSet &Set, const PerfStat &Stat, const PerfStat &Base)
+{
+	double Noise=1.4826*((Stat.Mad>Base.Mad)?Stat.Mad:Base.Mad);
+
+	return (Stat.Ratio>Base.Ratio*(1+Set.Tol))&&(Stat.Ratio-Base.Ratio>Set.Sigma*Noise);
+}
+
+//Reference Iteration Time Differs from Baseline by More than Drift (Machine Speed Changed in a Way the Ratio does not Cancel)
+bool PerfShaky(const PerfSet &Set, const PerfStat &Stat, const PerfStat &Base)
+{
+	double Ref=Stat.Median/Stat.Ratio;
+	double BaseRef=Base.Median/Base.Ratio;
+
+	return fabs(Ref/BaseRef-1)>Set.Drift;
+}
+
+
+
+int main(int argc, char **argv)
+{
+	PerfSet Set;
+	PerfStat Cur[_PERF_CASE_MAX];
+	PerfStat Base[_PERF_CASE_MAX];
+	const char *BaseName="MiniMatPerf.txt";
+	bool IsUpdate=0;
+	u16 CurNum=0;
+	s16 BaseNum;
+	s16 Find[_PERF_CASE_MAX];
+	bool Slow[_PERF_CASE_MAX];
+	bool Flag[_PERF_CASE_MAX];
+	bool Shaky[_PERF_CASE_MAX];
+	PerfStat Again;
+	u16 Regress=0;
+	u16 Unstable=0;
+	s16 Index;
+	u16 ii,rr;
+	int kk;
+
+	for (kk=1;kk<argc;kk++)
+	{
+		if(strcmp(argv[kk],"-update")==0)
+		{
+			IsUpdate=1;
+		}
+		else if(kk+1<argc)
+		{
+			if(strcmp(argv[kk],"-base")==0){BaseName=argv[++kk];}
+			else if(strcmp(argv[kk],"-samples")==0){Set.Samples=(u16) atoi(argv[++kk]);}
+			else if(strcmp(argv[kk],"-warmup")==0){Set.Warmup=(u16) atoi(argv[++kk]);}
+			else if(strcmp(argv[kk],"-sample")==0){Set.SampleTime=atof(argv[++kk])*1e6;}
+			else if(strcmp(argv[kk],"-tol")==0){Set.Tol=atof(argv[++kk])/100;}
+			else if(strcmp(argv[kk],"-sigma")==0){Set.Sigma=atof(argv[++kk]);}
+			else if(strcmp(argv[kk],"-retry")==0){Set.Retry=(u16) atoi(argv[++kk]);}
+			else if(strcmp(argv[kk],"-drift")==0){Set.Drift=atof(argv[++kk])/100;}
+		}
+	}
+	if(Set.Samples==0)
+	{
+		Set.Samples=1;
+	}
+
+	CurNum+=PerfType<float>(Set,"float",Cur+CurNum);
+	CurNum+=PerfType<double>(Set,"double",Cur+CurNum);
+
+	if(IsUpdate)
+	{
+		for (ii=0;ii<CurNum;ii++)
+		{
+			PerfSteady(Set,Cur[ii]);
+		}
+		if(!PerfSave(BaseName,Cur,CurNum))
+		{
+			printf("Cannot write %s\n",BaseName);
+			return 2;
+		}
+		printf("Baseline of %u cases written to %s\n",(unsigned) CurNum,BaseName);
+		return 0;
+	}
+
+	BaseNum=PerfLoad(BaseName,Base);
+	if(BaseNum<0)
+	{
+		printf("Cannot read %s, create it with -update\n",BaseName);
+		return 2;
+	}
+
+	for (ii=0;ii<CurNum;ii++)
+	{
+		Find[ii]=PerfFind(Cur[ii],Base,BaseNum);
+		Slow[ii]=(Find[ii]>=0)&&PerfSlow(Set,Cur[ii],Base[Find[ii]]);
+		Flag[ii]=Slow[ii];
+		Shaky[ii]=Slow[ii]&&PerfShaky(Set,Cur[ii],Base[Find[ii]]);
+	}
+	//Flagged Cases are Measured Again after the Whole Pass, so One Burst of Load does not Cover All Rounds
+	for (rr=0;rr<Set.Retry;rr++)
+	{
+		for (ii=0;ii<CurNum;ii++)
+		{
+			if(Slow[ii]&&PerfAgain(Set,Cur[ii],Again))
+			{
+				Slow[ii]=PerfSlow(Set,Again,Base[Find[ii]]);
+				Shaky[ii]=Slow[ii]&&(Shaky[ii]||PerfShaky(Set,Again,Base[Find[ii]]));
+			}
+		}
+	}
+
+	printf("%-8s %-7s %5s %14s %14s %9s  %s\n","op","type","size","base_ns","now_ns","change","status");
+	for (ii=0;ii<CurNum;ii++)
+	{
+		Index=Find[ii];
+		if(Index<0)
+		{
+			printf("%-8s %-7s %5u %14s %14.2f %9s  %s\n",Cur[ii].Op,Cur[ii].TypeName,(unsigned) Cur[ii].Size,"-",Cur[ii].Median,"-","new");
+			continue;
+		}
+		Unstable+=Slow[ii]&&Shaky[ii];
+		Slow[ii]=Slow[ii]&&(!Shaky[ii]);
+		Regress+=Slow[ii];
+		printf("%-8s %-7s %5u %14.2f %14.2f %+8.1f%%  %s\n",Cur[ii].Op,Cur[ii].TypeName,(unsigned) Cur[ii].Size,
+			Base[Index].Median,Cur[ii].Median,100*(Cur[ii].Ratio/Base[Index].Ratio-1),Slow[ii]?"REGRESSION":(Shaky[ii]?"unstable":(Flag[ii]?"noise":"ok")));
+	}
+
+	if(Regress>0)
+	{
+		printf("\n%u regression(s) against %s:\n",(unsigned) Regress,BaseName);
+		for (ii=0;ii<CurNum;ii++)
+		{
+			if(Slow[ii])
+			{
+				printf("  %s<%s> %ux%u\n",Cur[ii].Op,Cur[ii].TypeName,(unsigned) Cur[ii].Size,(unsigned) Cur[ii].Size);
+			}
+		}
+		return 1;
+	}
+	if(Unstable>0)
+	{
+		printf("\n%u slow case(s) with the reference time off the baseline by more than %.0f%%, rerun on an idle machine\n",(unsigned) Unstable,100*Set.Drift);
+		return 2;
+	}
+
+	printf("\nNo regression against %s\n",BaseName);
+	return 0;
+}
@@ -0,0 +1,798 @@
+/*
+*File Name: MiniMatSoA.hpp
+*File Creation Date: October 18th 2026
+*File Final Revised Date: October 18th 2026
+*Author: Jiamin Wang
+*Description: Structure of Arrays Batch of Small Matrices of MiniMat
+*/
+
+/*
+*Note:
+*SoAMat holds Num matrices of the same Row*Col shape interleaved by element: element (i,j) of all matrices is one
+*	contiguous lane, so every kernel runs its inner loop across matrices and the compiler packs 4/8/16 of them per instruction.
+*Lanes are padded to a multiple of _SOA_LANE matrices (storage is Row*Col*Stride elements, see _SOA_STRIDE).
+*Matrix indexes are 0-based (same as BatchAt), row and column indexes are 1-based like Mat.
+*Convert with Put/Get (one Mat), FromMat/ToMat (an array of Mat) and FromBatch/ToBatch (a batch buffer of MiniMatBatch.hpp).
+*Gemm, Mult and Cross write into the calling SoAMat, Point and Norm write one value per matrix into a plain array;
+*	operands must not be the calling SoAMat. Sums are in the element type and Norm is not rescaled against overflow.
+*Gemm walks _SOA_BLOCK matrices at a time to stay in cache; Gemm, Cross, Det, Inv and Solve are split across cores with OpenMP
+*	when there are at least _MATBATCH_PAR matrices.
+*Det, Inv and Solve of 3*3 and 4*4 matrices run lane-wise with closed forms (cofactors and adjugate, no pivoting), so they vectorize
+*	across matrices like Mult (at -O3, GCC 12 keeps 4*4 Inv scalar at -O2). Without pivoting they lose more digits than BatchInv on badly conditioned matrices (the 4*4 form
+*	subtracts products of 2*2 minors), use BatchInv of MiniMatBatch.hpp for those. Other sizes go through a heap batch copy and
+*	BatchDet, BatchInv or BatchSolve. Same as Inv of Mat, a matrix whose determinant is within 1e-5 of 0 is singular;
+*	Inv and Solve write 0s for it and return the number of singular matrices.
+*/
+
+#ifndef MINIMATSOA_HPP_
+#define MINIMATSOA_HPP_
+
+#include "MiniMatBatch.hpp"
+
+#ifndef _SOA_LANE
+	#define _SOA_LANE 16//Lane Padding in Matrices (16 Fills a 64 Bytes Vector of float)
+#endif
+
+#ifndef _SOA_BLOCK
+	#define _SOA_BLOCK 256//Matrices per Cache Block of the Kernels (Multiple of _SOA_LANE)
+#endif
+
+#define _SOA_STRIDE(NUM) (((((u32) NUM)+_SOA_LANE-1)/_SOA_LANE)*_SOA_LANE)
+
+//Define a fixed SoA batch
+#define DefSoA(TYPE,NAME,ROW,COL,NUM) \
+	TYPE MACON(NAME,DEFSOA)[((u32) ROW)*((u32) COL)*_SOA_STRIDE(NUM)];\
+	SoAMat<TYPE> NAME( (u8) ROW , (u8) COL , (u32) NUM , ((TYPE *) &(MACON(NAME,DEFSOA)[0])) );
+
+//Define a temporary SoA batch on heap (For large batches)
+#if _HEAPSCOPE
+	#define TmpSoA(TYPE,NAME,ROW,COL,NUM) \
+			TYPE *MACON(NAME,TMPSOA)=(TYPE *) malloc(sizeof(TYPE)*((u32) ROW)*((u32) COL)*_SOA_STRIDE(NUM));\
+			MiniMat_HeapScope._HeapPlus(sizeof(TYPE)*((u32) ROW)*((u32) COL)*_SOA_STRIDE(NUM));\
+			SoAMat<TYPE> NAME( (u8) ROW , (u8) COL , (u32) NUM , MACON(NAME,TMPSOA) );\
+			NAME.SetTemp();
+#else
+	#define TmpSoA(TYPE,NAME,ROW,COL,NUM) \
+			TYPE *MACON(NAME,TMPSOA)=(TYPE *) malloc(sizeof(TYPE)*((u32) ROW)*((u32) COL)*_SOA_STRIDE(NUM));\
+			SoAMat<TYPE> NAME( (u8) ROW , (u8) COL , (u32) NUM , MACON(NAME,TMPSOA) );\
+			NAME.SetTemp();
+#endif
+
+
+
+template <class Type>
+
+class SoAMat
+{
+
+protected://Variables (None of the variables can be directly accessed)
+
+	bool _IsTemp;//Indicate Temperorary Status
+
+	Type *_Value;//Root Pointer of Lanes
+	u8 _Row;//Number of Rows of Each Matrix
+	u8 _Col;//Number of Columns of Each Matrix
+	u16 _Size;//Elements of Each Matrix (Number of Lanes)
+	u32 _Num;//Number of Matrices
+	u32 _Stride;//Distance between Lanes (Num Padded to _SOA_LANE)
+
+	//Square Root Matching the Element Type
+	static float _Sqrt(float Value)
+	{
+		return sqrtf(Value);
+	}
+
+	//Square Root Matching the Element Type
+	static double _Sqrt(double Value)
+	{
+		return sqrt(Value);
+	}
+
+	//Square Root of Other Types (Through Float)
+	template <class Other>
+	static Other _Sqrt(Other Value)
+	{
+		return (Other) sqrtf((float) Value);
+	}
+
+	//Number of Cache Blocks
+	u32 _BlockNum()
+	{
+		return (_Num+_SOA_BLOCK-1)/_SOA_BLOCK;
+	}
+
+	//Matrices in a Cache Block
+	u32 _BlockLen(u32 Block)
+	{
+		return ((Block+1)*_SOA_BLOCK<=_Num)?_SOA_BLOCK:(_Num-Block*_SOA_BLOCK);
+	}
+
+	//One Output Lane of Gemm over Len Matrices (A and B Lanes of the Inner Sum are Step Apart, Inline for Constant Inner)
+	static inline void _GemmLane(Type *Out, Type *APtr, u32 AStep, Type *BPtr, u32 BStep, u8 Inner, u32 Len, Type Alpha, Type Beta)
+	{
+		Type SumVal;
+		u32 nn;
+		u8 kk;
+
+		for(nn=0;nn<Len;nn++)
+		{
+			SumVal=0;
+			for(kk=0;kk<Inner;kk++)
+			{
+				SumVal+=(*(APtr+kk*AStep+nn))*(*(BPtr+kk*BStep+nn));
+			}
+			*(Out+nn)=(Beta==0)?(Alpha*SumVal):(Alpha*SumVal+Beta*(*(Out+nn)));
+		}
+	}
+
+	//Determinant of a 3*3 Matrix by Cofactors of its First Row (C Holds the Three Cofactors)
+	static inline Type _Cof3(const Type *M, Type *C)
+	{
+		*C=(*(M+4))*(*(M+8))-(*(M+5))*(*(M+7));
+		*(C+1)=(*(M+5))*(*(M+6))-(*(M+3))*(*(M+8));
+		*(C+2)=(*(M+3))*(*(M+7))-(*(M+4))*(*(M+6));
+		return (*M)*(*C)+(*(M+1))*(*(C+1))+(*(M+2))*(*(C+2));
+	}
+
+	//Inverse of a 3*3 Matrix times Scale (Adjugate, Scale is 1/Det or 0 for Singular)
+	static inline void _Adj3(const Type *M, const Type *C, Type Scale, Type *Out)
+	{
+		*Out=(*C)*Scale;
+		*(Out+1)=((*(M+2))*(*(M+7))-(*(M+1))*(*(M+8)))*Scale;
+		*(Out+2)=((*(M+1))*(*(M+5))-(*(M+2))*(*(M+4)))*Scale;
+		*(Out+3)=(*(C+1))*Scale;
+		*(Out+4)=((*M)*(*(M+8))-(*(M+2))*(*(M+6)))*Scale;
+		*(Out+5)=((*(M+2))*(*(M+3))-(*M)*(*(M+5)))*Scale;
+		*(Out+6)=(*(C+2))*Scale;
+		*(Out+7)=((*(M+1))*(*(M+6))-(*M)*(*(M+7)))*Scale;
+		*(Out+8)=((*M)*(*(M+4))-(*(M+1))*(*(M+3)))*Scale;
+	}
+
+	//Determinant of a 4*4 Matrix by 2*2 Minors of its Top (S) and Bottom (C) Row Pairs (Six Each)
+	static inline Type _Cof4(const Type *M, Type *S, Type *C)
+	{
+		*S=(*M)*(*(M+5))-(*(M+4))*(*(M+1));
+		*(S+1)=(*M)*(*(M+6))-(*(M+4))*(*(M+2));
+		*(S+2)=(*M)*(*(M+7))-(*(M+4))*(*(M+3));
+		*(S+3)=(*(M+1))*(*(M+6))-(*(M+5))*(*(M+2));
+		*(S+4)=(*(M+1))*(*(M+7))-(*(M+5))*(*(M+3));
+		*(S+5)=(*(M+2))*(*(M+7))-(*(M+6))*(*(M+3));
+		*C=(*(M+8))*(*(M+13))-(*(M+12))*(*(M+9));
+		*(C+1)=(*(M+8))*(*(M+14))-(*(M+12))*(*(M+10));
+		*(C+2)=(*(M+8))*(*(M+15))-(*(M+12))*(*(M+11));
+		*(C+3)=(*(M+9))*(*(M+14))-(*(M+13))*(*(M+10));
+		*(C+4)=(*(M+9))*(*(M+15))-(*(M+13))*(*(M+11));
+		*(C+5)=(*(M+10))*(*(M+15))-(*(M+14))*(*(M+11));
+		return (*S)*(*(C+5))-(*(S+1))*(*(C+4))+(*(S+2))*(*(C+3))+(*(S+3))*(*(C+2))-(*(S+4))*(*(C+1))+(*(S+5))*(*C);
+	}
+
+	//Inverse of a 4*4 Matrix times Scale (Adjugate from the Minors of _Cof4, Scale is 1/Det or 0 for Singular)
+	static inline void _Adj4(const Type *M, const Type *S, const Type *C, Type Scale, Type *Out)
+	{
+		*Out=((*(M+5))*(*(C+5))-(*(M+6))*(*(C+4))+(*(M+7))*(*(C+3)))*Scale;
+		*(Out+1)=((*(M+2))*(*(C+4))-(*(M+1))*(*(C+5))-(*(M+3))*(*(C+3)))*Scale;
+		*(Out+2)=((*(M+13))*(*(S+5))-(*(M+14))*(*(S+4))+(*(M+15))*(*(S+3)))*Scale;
+		*(Out+3)=((*(M+10))*(*(S+4))-(*(M+9))*(*(S+5))-(*(M+11))*(*(S+3)))*Scale;
+		*(Out+4)=((*(M+6))*(*(C+2))-(*(M+4))*(*(C+5))-(*(M+7))*(*(C+1)))*Scale;
+		*(Out+5)=((*M)*(*(C+5))-(*(M+2))*(*(C+2))+(*(M+3))*(*(C+1)))*Scale;
+		*(Out+6)=((*(M+14))*(*(S+2))-(*(M+12))*(*(S+5))-(*(M+15))*(*(S+1)))*Scale;
+		*(Out+7)=((*(M+8))*(*(S+5))-(*(M+10))*(*(S+2))+(*(M+11))*(*(S+1)))*Scale;
+		*(Out+8)=((*(M+4))*(*(C+4))-(*(M+5))*(*(C+2))+(*(M+7))*(*C))*Scale;
+		*(Out+9)=((*(M+1))*(*(C+2))-(*M)*(*(C+4))-(*(M+3))*(*C))*Scale;
+		*(Out+10)=((*(M+12))*(*(S+4))-(*(M+13))*(*(S+2))+(*(M+15))*(*S))*Scale;
+		*(Out+11)=((*(M+9))*(*(S+2))-(*(M+8))*(*(S+4))-(*(M+11))*(*S))*Scale;
+		*(Out+12)=((*(M+5))*(*(C+1))-(*(M+4))*(*(C+3))-(*(M+6))*(*C))*Scale;
+		*(Out+13)=((*M)*(*(C+3))-(*(M+1))*(*(C+1))+(*(M+2))*(*C))*Scale;
+		*(Out+14)=((*(M+13))*(*(S+1))-(*(M+12))*(*(S+3))-(*(M+14))*(*S))*Scale;
+		*(Out+15)=((*(M+8))*(*(S+3))-(*(M+9))*(*(S+1))+(*(M+10))*(*S))*Scale;
+	}
+
+	//1 for a Regular Determinant, 0 when it is within 1e-5 of 0 (Same Test as Inv of Mat)
+	static inline Type _Keep(Type DetVal)
+	{
+		return (fabs(DetVal)>1e-5)?((Type) 1):((Type) 0);
+	}
+
+	//Scale of the Adjugate: 1/Det, or 0/(Det+1)=0 when Singular (Arithmetic instead of a Select, so the Division Stays Unconditional and Lanes Vectorize)
+	static inline Type _Scale(Type DetVal, Type Keep)
+	{
+		return Keep/(DetVal+((Type) 1)-Keep);
+	}
+
+	//Gather One 3*3 Matrix from its Lanes (In is its Element 1,1 and Lanes are Step Apart)
+	static inline void _Load3(Type *M, const Type *In, u32 Step)
+	{
+		*M=*In;
+		*(M+1)=*(In+Step);
+		*(M+2)=*(In+2*Step);
+		*(M+3)=*(In+3*Step);
+		*(M+4)=*(In+4*Step);
+		*(M+5)=*(In+5*Step);
+		*(M+6)=*(In+6*Step);
+		*(M+7)=*(In+7*Step);
+		*(M+8)=*(In+8*Step);
+	}
+
+	//Gather One 4*4 Matrix from its Lanes
+	static inline void _Load4(Type *M, const Type *In, u32 Step)
+	{
+		*M=*In;
+		*(M+1)=*(In+Step);
+		*(M+2)=*(In+2*Step);
+		*(M+3)=*(In+3*Step);
+		*(M+4)=*(In+4*Step);
+		*(M+5)=*(In+5*Step);
+		*(M+6)=*(In+6*Step);
+		*(M+7)=*(In+7*Step);
+		*(M+8)=*(In+8*Step);
+		*(M+9)=*(In+9*Step);
+		*(M+10)=*(In+10*Step);
+		*(M+11)=*(In+11*Step);
+		*(M+12)=*(In+12*Step);
+		*(M+13)=*(In+13*Step);
+		*(M+14)=*(In+14*Step);
+		*(M+15)=*(In+15*Step);
+	}
+
+	//Scatter One 3*3 Matrix to its Lanes
+	static inline void _Store3(Type *Out, u32 Step, const Type *V)
+	{
+		*Out=*V;
+		*(Out+Step)=*(V+1);
+		*(Out+2*Step)=*(V+2);
+		*(Out+3*Step)=*(V+3);
+		*(Out+4*Step)=*(V+4);
+		*(Out+5*Step)=*(V+5);
+		*(Out+6*Step)=*(V+6);
+		*(Out+7*Step)=*(V+7);
+		*(Out+8*Step)=*(V+8);
+	}
+
+	//Scatter One 4*4 Matrix to its Lanes
+	static inline void _Store4(Type *Out, u32 Step, const Type *V)
+	{
+		*Out=*V;
+		*(Out+Step)=*(V+1);
+		*(Out+2*Step)=*(V+2);
+		*(Out+3*Step)=*(V+3);
+		*(Out+4*Step)=*(V+4);
+		*(Out+5*Step)=*(V+5);
+		*(Out+6*Step)=*(V+6);
+		*(Out+7*Step)=*(V+7);
+		*(Out+8*Step)=*(V+8);
+		*(Out+9*Step)=*(V+9);
+		*(Out+10*Step)=*(V+10);
+		*(Out+11*Step)=*(V+11);
+		*(Out+12*Step)=*(V+12);
+		*(Out+13*Step)=*(V+13);
+		*(Out+14*Step)=*(V+14);
+		*(Out+15*Step)=*(V+15);
+	}
+
+	//Scatter One Column of V*B for a 3*3 V (In is the Column of B, Both Lane Sets are Step and OStep Apart)
+	static inline void _Apply3(Type *Out, u32 OStep, const Type *V, const Type *In, u32 Step)
+	{
+		*Out=(*V)*(*In)+(*(V+1))*(*(In+Step))+(*(V+2))*(*(In+2*Step));
+		*(Out+OStep)=(*(V+3))*(*In)+(*(V+4))*(*(In+Step))+(*(V+5))*(*(In+2*Step));
+		*(Out+2*OStep)=(*(V+6))*(*In)+(*(V+7))*(*(In+Step))+(*(V+8))*(*(In+2*Step));
+	}
+
+	//Scatter One Column of V*B for a 4*4 V
+	static inline void _Apply4(Type *Out, u32 OStep, const Type *V, const Type *In, u32 Step)
+	{
+		*Out=(*V)*(*In)+(*(V+1))*(*(In+Step))+(*(V+2))*(*(In+2*Step))+(*(V+3))*(*(In+3*Step));
+		*(Out+OStep)=(*(V+4))*(*In)+(*(V+5))*(*(In+Step))+(*(V+6))*(*(In+2*Step))+(*(V+7))*(*(In+3*Step));
+		*(Out+2*OStep)=(*(V+8))*(*In)+(*(V+9))*(*(In+Step))+(*(V+10))*(*(In+2*Step))+(*(V+11))*(*(In+3*Step));
+		*(Out+3*OStep)=(*(V+12))*(*In)+(*(V+13))*(*(In+Step))+(*(V+14))*(*(In+2*Step))+(*(V+15))*(*(In+3*Step));
+	}
+
+	//Determinants of Num Square Matrices of Row 3 or 4 whose Lanes are Step Apart
+	template <u8 Row>
+	static void _DetLane(Type *Out, const Type *In, u32 Step, u32 Num)
+	{
+		s32 nn;
+
+#ifdef _OPENMP
+		#pragma omp parallel for if(Num>=_MATBATCH_PAR) schedule(static)
+#endif
+		for(nn=0;nn<((s32) Num);nn++)
+		{
+			Type M[16],S[6],C[6];
+
+			if(Row==3)
+			{
+				_Load3(M,In+nn,Step);
+				*(Out+nn)=_Cof3(M,C);
+			}
+			else
+			{
+				_Load4(M,In+nn,Step);
+				*(Out+nn)=_Cof4(M,S,C);
+			}
+		}
+	}
+
+	//Inverses of Num Square Matrices of Row 3 or 4 (Return Number of Singular Matrices, which are Set to 0s)
+	template <u8 Row>
+	static u32 _InvLane(Type *Out, u32 OStep, const Type *In, u32 Step, u32 Num)
+	{
+		u32 Singular=0;
+		s32 nn;
+
+#ifdef _OPENMP
+		#pragma omp parallel for if(Num>=_MATBATCH_PAR) schedule(static) reduction(+:Singular)
+#endif
+		for(nn=0;nn<((s32) Num);nn++)
+		{
+			Type M[16],V[16],S[6],C[6];
+			Type DetVal,Keep;
+
+			if(Row==3)
+			{
+				_Load3(M,In+nn,Step);
+				DetVal=_Cof3(M,C);
+				Keep=_Keep(DetVal);
+				_Adj3(M,C,_Scale(DetVal,Keep),V);
+				_Store3(Out+nn,OStep,V);
+			}
+			else
+			{
+				_Load4(M,In+nn,Step);
+				DetVal=_Cof4(M,S,C);
+				Keep=_Keep(DetVal);
+				_Adj4(M,S,C,_Scale(DetVal,Keep),V);
+				_Store4(Out+nn,OStep,V);
+			}
+			Singular+=(Keep==0)?1:0;
+		}
+		return Singular;
+	}
+
+	//Solve A*X=B for Num Matrices of Row 3 or 4, One Column of B per Pass (Inverse is Redone per Column, Singular Ones are Set to 0s)
+	template <u8 Row>
+	static u32 _SolveLane(Type *Out, u32 OStep, const Type *InA, u32 AStep, const Type *InB, u32 BStep, u8 Col, u32 Num)
+	{
+		u32 Singular=0;
+		s32 nn;
+		u8 jj;
+
+		for(jj=0;jj<Col;jj++)
+		{
+			Singular=0;
+#ifdef _OPENMP
+			#pragma omp parallel for if(Num>=_MATBATCH_PAR) schedule(static) reduction(+:Singular)
+#endif
+			for(nn=0;nn<((s32) Num);nn++)
+			{
+				Type M[16],V[16],S[6],C[6];
+				Type DetVal,Keep;
+
+				if(Row==3)
+				{
+					_Load3(M,InA+nn,AStep);
+					DetVal=_Cof3(M,C);
+					Keep=_Keep(DetVal);
+					_Adj3(M,C,_Scale(DetVal,Keep),V);
+					_Apply3(Out+jj*OStep+nn,((u32) Col)*OStep,V,InB+jj*BStep+nn,((u32) Col)*BStep);
+				}
+				else
+				{
+					_Load4(M,InA+nn,AStep);
+					DetVal=_Cof4(M,S,C);
+					Keep=_Keep(DetVal);
+					_Adj4(M,S,C,_Scale(DetVal,Keep),V);
+					_Apply4(Out+jj*OStep+nn,((u32) Col)*OStep,V,InB+jj*BStep+nn,((u32) Col)*BStep);
+				}
+				Singular+=(Keep==0)?1:0;
+			}
+		}
+		return Singular;
+	}
+
+	//Gemm of One Cache Block
+	void _GemmBlock(u32 Block, Type Alpha, SoAMat<Type> &CalcSoAA, SoAMat<Type> &CalcSoAB, Type Beta)
+	{
+		u32 Base=Block*_SOA_BLOCK;
+		u32 Len=_BlockLen(Block);
+		u8 Inner=CalcSoAA._Col;
+		u32 AStep=CalcSoAA._Stride;
+		u32 BStep=((u32) CalcSoAB._Col)*CalcSoAB._Stride;
+		Type *APtr,*BPtr,*OPtr;
+		u8 ii,jj;
+
+		for(ii=0;ii<_Row;ii++)
+		{
+			for(jj=0;jj<_Col;jj++)
+			{
+				APtr=CalcSoAA._Value+((u32) ii)*Inner*AStep+Base;
+				BPtr=CalcSoAB._Value+((u32) jj)*CalcSoAB._Stride+Base;
+				OPtr=_Value+(((u32) ii)*_Col+jj)*_Stride+Base;
+				if(Inner==3)
+				{
+					_GemmLane(OPtr,APtr,AStep,BPtr,BStep,3,Len,Alpha,Beta);
+				}
+				else if(Inner==4)
+				{
+					_GemmLane(OPtr,APtr,AStep,BPtr,BStep,4,Len,Alpha,Beta);
+				}
+				else if(Inner==6)
+				{
+					_GemmLane(OPtr,APtr,AStep,BPtr,BStep,6,Len,Alpha,Beta);
+				}
+				else
+				{
+					_GemmLane(OPtr,APtr,AStep,BPtr,BStep,Inner,Len,Alpha,Beta);
+				}
+			}
+		}
+	}
+
+
+
+public://Functions
+
+	//////Constrcutors & Destructors
+
+	//Global Variable Constructor
+	explicit SoAMat(u8 Row, u8 Col, u32 Num, Type *Value):
+	_IsTemp(0),
+	_Value(Value),_Row(Row),_Col(Col),_Size(((u16) Row)*((u16) Col)),_Num(Num),_Stride(_SOA_STRIDE(Num))
+	{
+	};
+
+	//Variable Destructor (Designed for Regional Variable)
+	~SoAMat(){};
+
+	//////End of Constrcutors & Destructors
+
+
+
+	//////Content Operation (These Functions Work on Itself)
+
+	//Set Temp Status
+	SoAMat<Type> & SetTemp()
+	{
+		_IsTemp=1;
+		return *this;
+	}
+
+	//Clean Temp
+	void CleanTmp()
+	{
+		if(_IsTemp)
+		{
+#if _HEAPSCOPE
+			MiniMat_HeapScope._HeapMinus(((u32)sizeof(Type))*((u32)_Size)*_Stride);
+#endif
+			free(_Value);
+			_Value=NULL;
+		}
+		return;
+	}
+
+	//Insert Single Value of One Matrix
+	SoAMat<Type> & Set(u32 Index, u8 Row, u8 Col, Type Value)
+	{
+		*(_Value+(((u32) Row-1)*_Col+(Col-1))*_Stride+Index)=Value;
+		return *this;
+	}
+
+	//Copy One Matrix in (This will destroy Input Mat if is Temp Mat)
+	SoAMat<Type> & Put(u32 Index, Mat<Type> InMat)
+	{
+		Type *InPtr=InMat.Pt();
+		Type *LPtr=_Value+Index;
+		u16 ee;
+
+		for(ee=0;ee<_Size;ee++)
+		{
+			*LPtr=*(InPtr+ee);
+			LPtr+=_Stride;
+		}
+		InMat.CleanRet();
+		return *this;
+	}
+
+	//Copy from an Array of Num Mats
+	SoAMat<Type> & FromMat(Mat<Type> *InMat)
+	{
+		Type *LPtr=_Value;
+		u16 ee;
+		u32 nn;
+
+		for(ee=0;ee<_Size;ee++)
+		{
+			for(nn=0;nn<_Num;nn++)
+			{
+				*(LPtr+nn)=*((InMat+nn)->Pt()+ee);
+			}
+			LPtr+=_Stride;
+		}
+		return *this;
+	}
+
+	//Copy from a Batch Buffer (Num Row-Major Matrices Back to Back)
+	SoAMat<Type> & FromBatch(const Type *Buffer)
+	{
+		Type *LPtr=_Value;
+		u16 ee;
+		u32 nn;
+
+		for(ee=0;ee<_Size;ee++)
+		{
+			for(nn=0;nn<_Num;nn++)
+			{
+				*(LPtr+nn)=*(Buffer+nn*_Size+ee);
+			}
+			LPtr+=_Stride;
+		}
+		return *this;
+	}
+
+	//Calculate General Multiply This=Alpha*A*B+Beta*This for Each Matrix (Beta=0 Overwrites without Reading)
+	SoAMat<Type> & Gemm(Type Alpha, SoAMat<Type> &CalcSoAA, SoAMat<Type> &CalcSoAB, Type Beta)
+	{
+		s32 bb;
+
+#ifdef _OPENMP
+		#pragma omp parallel for if(_Num>=_MATBATCH_PAR) schedule(static)
+#endif
+		for(bb=0;bb<((s32) _BlockNum());bb++)
+		{
+			_GemmBlock((u32) bb,Alpha,CalcSoAA,CalcSoAB,Beta);
+		}
+		return *this;
+	}
+
+	//Calculate Multiply This=L*R for Each Matrix
+	SoAMat<Type> & Mult(SoAMat<Type> &CalcSoAL, SoAMat<Type> &CalcSoAR)
+	{
+		return Gemm(1,CalcSoAL,CalcSoAR,0);
+	}
+
+	//Calculate Inverse This=Inv(A) for Each Matrix (Return Number of Singular Matrices, which are Set to 0s)
+	u32 Inv(SoAMat<Type> &CalcSoA)
+	{
+		u32 Singular;
+
+		if(_Row==3)
+		{
+			return _InvLane<3>(_Value,_Stride,CalcSoA._Value,CalcSoA._Stride,_Num);
+		}
+		if(_Row==4)
+		{
+			return _InvLane<4>(_Value,_Stride,CalcSoA._Value,CalcSoA._Stride,_Num);
+		}
+		Type *Work=_BatchWorkPlus<Type>(2*((u32) _Size)*_Num);
+		CalcSoA.ToBatch(Work);
+		Singular=BatchInv(Work+((u32) _Size)*_Num,Work,_Row,_Num);
+		FromBatch(Work+((u32) _Size)*_Num);
+		_BatchWorkMinus(Work,2*((u32) _Size)*_Num);
+		return Singular;
+	}
+
+	//Solve A*This=B for Each Matrix (This is Row*Col of B, Return Number of Singular A, whose Solutions are Set to 0s)
+	u32 Solve(SoAMat<Type> &CalcSoAA, SoAMat<Type> &CalcSoAB)
+	{
+		u32 ASize=((u32) CalcSoAA._Size)*_Num;
+		u32 Singular;
+
+		if(_Row==3)
+		{
+			return _SolveLane<3>(_Value,_Stride,CalcSoAA._Value,CalcSoAA._Stride,CalcSoAB._Value,CalcSoAB._Stride,_Col,_Num);
+		}
+		if(_Row==4)
+		{
+			return _SolveLane<4>(_Value,_Stride,CalcSoAA._Value,CalcSoAA._Stride,CalcSoAB._Value,CalcSoAB._Stride,_Col,_Num);
+		}
+		Type *Work=_BatchWorkPlus<Type>(ASize+2*((u32) _Size)*_Num);
+		CalcSoAA.ToBatch(Work);
+		CalcSoAB.ToBatch(Work+ASize);
+		Singular=BatchSolve(Work+ASize+((u32) _Size)*_Num,Work,Work+ASize,_Row,_Col,_Num);
+		FromBatch(Work+ASize+((u32) _Size)*_Num);
+		_BatchWorkMinus(Work,ASize+2*((u32) _Size)*_Num);
+		return Singular;
+	}
+
+	//Calculate Cross Product This=L x R for Each Matrix (All are 3 Element Vectors)
+	SoAMat<Type> & Cross(SoAMat<Type> &CalcSoAL, SoAMat<Type> &CalcSoAR)
+	{
+		Type *L1=CalcSoAL._Value;
+		Type *L2=L1+CalcSoAL._Stride;
+		Type *L3=L2+CalcSoAL._Stride;
+		Type *R1=CalcSoAR._Value;
+		Type *R2=R1+CalcSoAR._Stride;
+		Type *R3=R2+CalcSoAR._Stride;
+		Type *O1=_Value;
+		Type *O2=O1+_Stride;
+		Type *O3=O2+_Stride;
+		u32 Num=_Num;
+		s32 nn;
+
+#ifdef _OPENMP
+		#pragma omp parallel for if(Num>=_MATBATCH_PAR) schedule(static)
+#endif
+		for(nn=0;nn<((s32) Num);nn++)
+		{
+			*(O1+nn)=(*(L2+nn))*(*(R3+nn))-(*(R2+nn))*(*(L3+nn));
+			*(O2+nn)=(*(L3+nn))*(*(R1+nn))-(*(R3+nn))*(*(L1+nn));
+			*(O3+nn)=(*(L1+nn))*(*(R2+nn))-(*(R1+nn))*(*(L2+nn));
+		}
+		return *this;
+	}
+
+	//////End of Content Operation
+
+
+
+	//////Self Interaction (These functions, if correctly used, generates new things)
+
+	//FeedBack RowNum
+	u8 Ro()
+	{
+		return _Row;
+	}
+
+	//FeedBack ColNum
+	u8 Co()
+	{
+		return _Col;
+	}
+
+	//FeedBack Number of Matrices
+	u32 Nm()
+	{
+		return _Num;
+	}
+
+	//FeedBack Distance between Lanes
+	u32 St()
+	{
+		return _Stride;
+	}
+
+	//FeedBack Root Pointer (Use with Caution)
+	Type * Pt()
+	{
+		return _Value;
+	}
+
+	//FeedBack Lane of an Element (Element (Row,Col) of All Matrices)
+	Type * Lane(u8 Row, u8 Col)
+	{
+		return _Value+(((u32) Row-1)*_Col+(Col-1))*_Stride;
+	}
+
+	//Extract Single Value of One Matrix
+	Type Val(u32 Index, u8 Row, u8 Col)
+	{
+		return *(_Value+(((u32) Row-1)*_Col+(Col-1))*_Stride+Index);
+	}
+
+	//Copy One Matrix out
+	Mat<Type> Get(u32 Index)
+	{
+		RetMat(Type,NewMat,_Row,_Col);
+		Type *OutPtr=NewMat.Pt();
+		Type *LPtr=_Value+Index;
+		u16 ee;
+
+		for(ee=0;ee<_Size;ee++)
+		{
+			*(OutPtr+ee)=*LPtr;
+			LPtr+=_Stride;
+		}
+		return NewMat;
+	}
+
+	//Copy to an Array of Num Mats
+	void ToMat(Mat<Type> *OutMat)
+	{
+		Type *LPtr=_Value;
+		u16 ee;
+		u32 nn;
+
+		for(ee=0;ee<_Size;ee++)
+		{
+			for(nn=0;nn<_Num;nn++)
+			{
+				*((OutMat+nn)->Pt()+ee)=*(LPtr+nn);
+			}
+			LPtr+=_Stride;
+		}
+		return;
+	}
+
+	//Copy to a Batch Buffer (Num Row-Major Matrices Back to Back)
+	void ToBatch(Type *Buffer)
+	{
+		Type *LPtr=_Value;
+		u16 ee;
+		u32 nn;
+
+		for(ee=0;ee<_Size;ee++)
+		{
+			for(nn=0;nn<_Num;nn++)
+			{
+				*(Buffer+nn*_Size+ee)=*(LPtr+nn);
+			}
+			LPtr+=_Stride;
+		}
+		return;
+	}
+
+	//Calculate Point Product of Each Matrix with the Same Matrix of R (Out Holds Num Values)
+	void Point(SoAMat<Type> &CalcSoAR, Type *Out)
+	{
+		Type *LPtr=_Value;
+		Type *RPtr=CalcSoAR._Value;
+		u16 ee;
+		u32 nn;
+
+		for(nn=0;nn<_Num;nn++)
+		{
+			*(Out+nn)=0;
+		}
+		for(ee=0;ee<_Size;ee++)
+		{
+			for(nn=0;nn<_Num;nn++)
+			{
+				*(Out+nn)+=(*(LPtr+nn))*(*(RPtr+nn));
+			}
+			LPtr+=_Stride;
+			RPtr+=CalcSoAR._Stride;
+		}
+		return;
+	}
+
+	//Calculate Determinant of Each Square Matrix (Out Holds Num Values)
+	void Det(Type *Out)
+	{
+		if(_Row==3)
+		{
+			_DetLane<3>(Out,_Value,_Stride,_Num);
+			return;
+		}
+		if(_Row==4)
+		{
+			_DetLane<4>(Out,_Value,_Stride,_Num);
+			return;
+		}
+		Type *Work=_BatchWorkPlus<Type>(((u32) _Size)*_Num);
+		ToBatch(Work);
+		BatchDet(Out,Work,_Row,_Num);
+		_BatchWorkMinus(Work,((u32) _Size)*_Num);
+		return;
+	}
+
+	//Calculate L2 Norm of Each Matrix (Out Holds Num Values)
+	void Norm(Type *Out)
+	{
+		Type *LPtr=_Value;
+		u16 ee;
+		u32 nn;
+
+		for(nn=0;nn<_Num;nn++)
+		{
+			*(Out+nn)=0;
+		}
+		for(ee=0;ee<_Size;ee++)
+		{
+			for(nn=0;nn<_Num;nn++)
+			{
+				*(Out+nn)+=(*(LPtr+nn))*(*(LPtr+nn));
+			}
+			LPtr+=_Stride;
+		}
+		for(nn=0;nn<_Num;nn++)
+		{
+			*(Out+nn)=_Sqrt(*(Out+nn));
+		}
+		return;
+	}
+
+	//////End of Self Interaction
+};
+
+
+#endif
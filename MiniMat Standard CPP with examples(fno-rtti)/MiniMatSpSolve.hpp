@@ -0,0 +1,1199 @@
+/*
+*File Name: MiniMatSpSolve.hpp
+*File Creation Date: October 18th 2026
+*File Final Revised Date: October 18th 2026
+*Author: Jiamin Wang
+*Description: Sparse Direct Solvers (Cholesky and LU) of MiniMat
+*/
+
+/*
+*Note:
+*SpChol solves symmetric positive definite systems (both triangles stored), SpLU solves general square systems; both work on SpMat.
+*Both reorder the unknowns by nested dissection of the graph of A+A' to reduce fill-in.
+*Analyze() is the symbolic phase (ordering, elimination tree, storage of the factors), it allocates all memory once.
+*Factor() is the numeric phase and can be called again and again for matrixes with the same nonzero pattern.
+*SpLU::Factor() chooses pivots (preferring the diagonal), SpLU::Refactor() reuses the pivots and patterns of the last Factor().
+*SpLU storage is _SPARSE_LU_FILL times the fill of Cholesky of A+A', Factor() returns 0 if off diagonal pivots need more.
+*Right hand sides are plain arrays and are solved in place; call CleanTmp() to release the memory.
+*Nodes are u16, so the dimension must be less than 65535.
+*/
+
+#ifndef MINIMATSPSOLVE_HPP_
+#define MINIMATSPSOLVE_HPP_
+
+#include "MiniMatSparse.hpp"
+
+#ifndef _SPARSE_ND_LEAF
+	#define _SPARSE_ND_LEAF 16
+#endif
+
+#ifndef _SPARSE_LU_FILL
+	#define _SPARSE_LU_FILL 2
+#endif
+
+#ifndef _SPARSE_LU_TOL
+	#define _SPARSE_LU_TOL 0.1
+#endif
+
+#define _SPARSE_NONE 0xFFFF
+
+
+
+class SpOrder
+{
+
+protected://Variables (None of the variables can be directly accessed)
+
+	bool _IsAnalyzed;//Indicate Symbolic Analysis Status
+	bool _IsFactored;//Indicate Numeric Factorization Status
+
+	u16 _Row;//Number of Rows (Same as Number of Columns)
+	u16 *_Perm;//Elimination Order (k-th Eliminated Original Node)
+	u16 *_PInv;//Inverse of Elimination Order
+	u32 _SymNz;//Nonzeros of Cholesky Factor of A+A' in Elimination Order
+	u32 _Byte;//Heap Memory Held by the Solver
+
+	//Allocate and Count Heap Memory
+	void * _Alloc(u32 Byte)
+	{
+		_Byte+=Byte;
+		return malloc(Byte);
+	}
+
+	//Release Memory Allocated by _Alloc
+	void _Free(void *Ptr, u32 Byte)
+	{
+		if(Ptr!=NULL)
+		{
+			_Byte-=Byte;
+			free(Ptr);
+		}
+		return;
+	}
+
+	//Build Adjacency of A+A' without Diagonal from Compressed Lines
+	void _Graph(u16 Row, u32 *APtr, u16 *AIdx, u32 *GPtr, u16 *GAdj)
+	{
+		u16 ii,jj;
+		u32 kk;
+		for(ii=0;ii<=Row;ii++)
+		{
+			*(GPtr+ii)=0;
+		}
+		for(ii=0;ii<Row;ii++)
+		{
+			for(kk=*(APtr+ii);kk<*(APtr+ii+1);kk++)
+			{
+				jj=*(AIdx+kk);
+				if(jj!=ii)
+				{
+					(*(GPtr+ii+1))++;
+					(*(GPtr+jj+1))++;
+				}
+			}
+		}
+		for(ii=0;ii<Row;ii++)
+		{
+			*(GPtr+ii+1)+=*(GPtr+ii);
+		}
+		for(ii=0;ii<Row;ii++)
+		{
+			for(kk=*(APtr+ii);kk<*(APtr+ii+1);kk++)
+			{
+				jj=*(AIdx+kk);
+				if(jj!=ii)
+				{
+					*(GAdj+*(GPtr+ii))=jj;
+					(*(GPtr+ii))++;
+					*(GAdj+*(GPtr+jj))=ii;
+					(*(GPtr+jj))++;
+				}
+			}
+		}
+		for(ii=Row;ii>0;ii--)
+		{
+			*(GPtr+ii)=*(GPtr+ii-1);
+		}
+		*GPtr=0;
+	}
+
+	//Breadth First Search inside a Segment from Root (Return Number of Reached Nodes, Depth in Depth)
+	u16 _Search(u16 Root, u32 Stamp, u32 *GPtr, u16 *GAdj, u32 *Seg, u16 *Level, u16 *Queue, u16 &Depth)
+	{
+		u16 Head=0;
+		u16 Tail=1;
+		u16 Node,Next;
+		u32 kk;
+		*Queue=Root;
+		*(Level+Root)=0;
+		Depth=0;
+		while(Head<Tail)
+		{
+			Node=*(Queue+Head);
+			Head++;
+			for(kk=*(GPtr+Node);kk<*(GPtr+Node+1);kk++)
+			{
+				Next=*(GAdj+kk);
+				if((*(Seg+Next)==Stamp)&&(*(Level+Next)==_SPARSE_NONE))
+				{
+					*(Level+Next)=*(Level+Node)+1;
+					Depth=*(Level+Next);
+					*(Queue+Tail)=Next;
+					Tail++;
+				}
+			}
+		}
+		return Tail;
+	}
+
+	//Order Nodes by Nested Dissection (Children First, Separators Last)
+	void _Dissect(u16 Row, u32 *GPtr, u16 *GAdj)
+	{
+		u32 *Seg=(u32 *) malloc(sizeof(u32)*((u32) Row)*4);
+		u32 *Stack=Seg+Row;
+		u16 *Level=(u16 *) malloc(sizeof(u16)*((u32) Row)*3);
+		u16 *Queue=Level+Row;
+		u16 *Buffer=Queue+Row;
+#if _HEAPSCOPE
+		MiniMat_HeapScope._HeapPlus((sizeof(u32)*4+sizeof(u16)*3)*((u32) Row));
+#endif
+
+		u16 ii,jj,Lo,Hi,Num,Reach,Count,Depth,OldDepth,NumA,NumB,NumS,Node;
+		u32 kk,Stamp,NewStamp,Top;
+		u8 Trial;
+		bool Border;
+		for(ii=0;ii<Row;ii++)
+		{
+			*(_Perm+ii)=ii;
+			*(Seg+ii)=0;
+		}
+
+		NewStamp=0;
+		Top=0;
+		*(Stack+Top)=0;
+		*(Stack+Top+1)=Row;
+		*(Stack+Top+2)=0;
+		Top+=3;
+		while(Top>0)
+		{
+			Top-=3;
+			Lo=(u16) *(Stack+Top);
+			Hi=(u16) *(Stack+Top+1);
+			Stamp=*(Stack+Top+2);
+			Num=Hi-Lo;
+			if(Num<=_SPARSE_ND_LEAF)
+			{
+				continue;
+			}
+
+			//Level Structure from a Pseudo Peripheral Node
+			Node=*(_Perm+Lo);
+			Depth=0;
+			for(Trial=0;Trial<4;Trial++)
+			{
+				for(ii=Lo;ii<Hi;ii++)
+				{
+					*(Level+*(_Perm+ii))=_SPARSE_NONE;
+				}
+				OldDepth=Depth;
+				Reach=_Search(Node,Stamp,GPtr,GAdj,Seg,Level,Queue,Depth);
+				if((Reach<Num)||((Trial>0)&&(Depth<=OldDepth)))
+				{
+					break;
+				}
+				Node=*(Queue+Reach-1);
+			}
+
+			if(Reach<Num)
+			{
+				//Disconnected: Every Component Becomes a Segment
+				Count=0;
+				ii=Lo;
+				while(1)
+				{
+					NewStamp++;
+					for(jj=Count;jj<Count+Reach;jj++)
+					{
+						*(Seg+*(Queue+jj))=NewStamp;
+					}
+					*(Stack+Top)=Lo+Count;
+					*(Stack+Top+1)=Lo+Count+Reach;
+					*(Stack+Top+2)=NewStamp;
+					Top+=3;
+					Count+=Reach;
+
+					while((ii<Hi)&&(*(Level+*(_Perm+ii))!=_SPARSE_NONE))
+					{
+						ii++;
+					}
+					if(ii==Hi)
+					{
+						break;
+					}
+					Reach=_Search(*(_Perm+ii),Stamp,GPtr,GAdj,Seg,Level,Queue+Count,Depth);
+				}
+				for(ii=0;ii<Num;ii++)
+				{
+					*(_Perm+Lo+ii)=*(Queue+ii);
+				}
+				continue;
+			}
+
+			if(Depth<2)
+			{
+				continue;
+			}
+
+			//Middle Level is the Separator, Nodes of It not Touching the Far Side Go Back to the Near Side
+			for(ii=Lo;ii<Hi;ii++)
+			{
+				Node=*(_Perm+ii);
+				if(*(Level+Node)==Depth/2)
+				{
+					Border=0;
+					for(kk=*(GPtr+Node);kk<*(GPtr+Node+1);kk++)
+					{
+						if((*(Seg+*(GAdj+kk))==Stamp)&&(*(Level+*(GAdj+kk))>Depth/2))
+						{
+							Border=1;
+							break;
+						}
+					}
+					if(!Border)
+					{
+						*(Level+Node)=0;
+					}
+				}
+			}
+			NumA=0;
+			NumB=0;
+			NumS=0;
+			for(ii=Lo;ii<Hi;ii++)
+			{
+				Node=*(_Perm+ii);
+				if(*(Level+Node)<Depth/2)
+				{
+					*(Buffer+NumA)=Node;
+					NumA++;
+				}
+			}
+			for(ii=Lo;ii<Hi;ii++)
+			{
+				Node=*(_Perm+ii);
+				if(*(Level+Node)>Depth/2)
+				{
+					*(Buffer+NumA+NumB)=Node;
+					NumB++;
+				}
+			}
+			for(ii=Lo;ii<Hi;ii++)
+			{
+				Node=*(_Perm+ii);
+				if(*(Level+Node)==Depth/2)
+				{
+					*(Buffer+NumA+NumB+NumS)=Node;
+					NumS++;
+				}
+			}
+
+			for(ii=0;ii<Num;ii++)
+			{
+				Node=*(Buffer+ii);
+				*(_Perm+Lo+ii)=Node;
+				if(ii<NumA)
+				{
+					*(Seg+Node)=NewStamp+1;
+				}
+				else if(ii<NumA+NumB)
+				{
+					*(Seg+Node)=NewStamp+2;
+				}
+				else
+				{
+					*(Seg+Node)=0xFFFFFFFF;
+				}
+			}
+
+			*(Stack+Top)=Lo;
+			*(Stack+Top+1)=Lo+NumA;
+			*(Stack+Top+2)=NewStamp+1;
+			Top+=3;
+			*(Stack+Top)=Lo+NumA;
+			*(Stack+Top+1)=Lo+NumA+NumB;
+			*(Stack+Top+2)=NewStamp+2;
+			Top+=3;
+			NewStamp+=2;
+		}
+
+		for(ii=0;ii<Row;ii++)
+		{
+			*(_PInv+*(_Perm+ii))=ii;
+		}
+
+#if _HEAPSCOPE
+		MiniMat_HeapScope._HeapMinus((sizeof(u32)*4+sizeof(u16)*3)*((u32) Row));
+#endif
+		free(Seg);
+		free(Level);
+	}
+
+	//Count Nonzeros of Cholesky Factor of the Graph in Elimination Order (Elimination Tree Reach)
+	u32 _Count(u32 *GPtr, u16 *GAdj)
+	{
+		u16 *Parent=(u16 *) malloc(sizeof(u16)*((u32) _Row)*2);
+		u16 *Flag=Parent+_Row;
+#if _HEAPSCOPE
+		MiniMat_HeapScope._HeapPlus(sizeof(u16)*((u32) _Row)*2);
+#endif
+
+		u16 kk,Node,Ancestor;
+		u32 pp,Count;
+		for(kk=0;kk<_Row;kk++)
+		{
+			*(Parent+kk)=_SPARSE_NONE;
+			*(Flag+kk)=_SPARSE_NONE;
+			for(pp=*(GPtr+*(_Perm+kk));pp<*(GPtr+*(_Perm+kk)+1);pp++)
+			{
+				Node=*(_PInv+*(GAdj+pp));
+				while((Node!=_SPARSE_NONE)&&(Node<kk))
+				{
+					Ancestor=*(Flag+Node);
+					*(Flag+Node)=kk;
+					if(Ancestor==_SPARSE_NONE)
+					{
+						*(Parent+Node)=kk;
+					}
+					Node=Ancestor;
+				}
+			}
+		}
+
+		Count=_Row;
+		for(kk=0;kk<_Row;kk++)
+		{
+			*(Flag+kk)=_SPARSE_NONE;
+		}
+		for(kk=0;kk<_Row;kk++)
+		{
+			*(Flag+kk)=kk;
+			for(pp=*(GPtr+*(_Perm+kk));pp<*(GPtr+*(_Perm+kk)+1);pp++)
+			{
+				Node=*(_PInv+*(GAdj+pp));
+				while((Node<kk)&&(*(Flag+Node)!=kk))
+				{
+					*(Flag+Node)=kk;
+					Count++;
+					Node=*(Parent+Node);
+				}
+			}
+		}
+
+#if _HEAPSCOPE
+		MiniMat_HeapScope._HeapMinus(sizeof(u16)*((u32) _Row)*2);
+#endif
+		free(Parent);
+		return Count;
+	}
+
+	//Order the Unknowns of a Square Sparse Matrix (Allocate _Perm and _PInv)
+	void _Order(u16 Row, u32 *APtr, u16 *AIdx)
+	{
+		_Row=Row;
+		_Perm=(u16 *) _Alloc(sizeof(u16)*((u32) Row));
+		_PInv=(u16 *) _Alloc(sizeof(u16)*((u32) Row));
+
+		u32 Nnz=*(APtr+Row);
+		u32 *GPtr=(u32 *) malloc(sizeof(u32)*(((u32) Row)+1));
+		u16 *GAdj=(u16 *) malloc(sizeof(u16)*2*Nnz+1);
+#if _HEAPSCOPE
+		MiniMat_HeapScope._HeapPlus(sizeof(u32)*(((u32) Row)+1)+sizeof(u16)*2*Nnz+1);
+#endif
+
+		_Graph(Row,APtr,AIdx,GPtr,GAdj);
+		_Dissect(Row,GPtr,GAdj);
+		_SymNz=_Count(GPtr,GAdj);
+
+#if _HEAPSCOPE
+		MiniMat_HeapScope._HeapMinus(sizeof(u32)*(((u32) Row)+1)+sizeof(u16)*2*Nnz+1);
+#endif
+		free(GPtr);
+		free(GAdj);
+	}
+
+
+
+public://Functions
+
+	//////Constrcutors & Destructors
+
+	//Empty Solver Constructor
+	explicit SpOrder():
+	_IsAnalyzed(0),_IsFactored(0),
+	_Row(0),_Perm(NULL),_PInv(NULL),_SymNz(0),_Byte(0)
+	{};
+
+	//Variable Destructor (Memory is Released by CleanTmp)
+	~SpOrder(){};
+
+	//////End of Constrcutors & Destructors
+
+
+
+	//////Self Interaction (These functions, if correctly used, generates new things)
+
+	//FeedBack RowNum
+	u16 Ro()
+	{
+		return _Row;
+	}
+
+	//FeedBack Memory Space
+	u32 Sp()
+	{
+		return _Byte;
+	}
+
+	//FeedBack Elimination Order (k-th Eliminated Original Node, 0-based)
+	u16 * PermPt()
+	{
+		return _Perm;
+	}
+
+	//FeedBack Factorization Status
+	bool Factored()
+	{
+		return _IsFactored;
+	}
+
+	//////End of Self Interaction
+
+};
+
+
+
+template <class Type>
+
+class SpChol : public SpOrder
+{
+
+protected://Variables (None of the variables can be directly accessed)
+
+	u16 *_Parent;//Elimination Tree
+	u32 *_LPtr;//Column Start of L
+	u16 *_LIdx;//Row Index of L (Permuted)
+	Type *_LVal;//Value of L
+	u32 _LNz;//Number of Nonzeros of L
+
+	Type *_X;//Dense Work Vector
+	u16 *_Stack;//Row Pattern Work Stack
+	u16 *_Flag;//Visited Flag
+	u32 *_Next;//Next Free Slot of Each Column of L
+
+	//Nonzero Pattern of Row K of L (Elimination Tree Reach, Result in _Stack[Top..Row))
+	u16 _Reach(SpMat<Type> &CalcSp, u16 K)
+	{
+		u16 Top=_Row;
+		u16 Len,Node;
+		u16 Line=*(_Perm+K);
+		u32 kk;
+		*(_Flag+K)=K;
+		for(kk=*(CalcSp.PtrPt()+Line);kk<*(CalcSp.PtrPt()+Line+1);kk++)
+		{
+			Node=*(_PInv+*(CalcSp.IdxPt()+kk));
+			if(Node>K)
+			{
+				continue;
+			}
+			Len=0;
+			while(*(_Flag+Node)!=K)
+			{
+				*(_Stack+Len)=Node;
+				Len++;
+				*(_Flag+Node)=K;
+				Node=*(_Parent+Node);
+			}
+			while(Len>0)
+			{
+				Top--;
+				Len--;
+				*(_Stack+Top)=*(_Stack+Len);
+			}
+		}
+		return Top;
+	}
+
+
+
+public://Functions
+
+	//////Constrcutors & Destructors
+
+	//Empty Solver Constructor
+	explicit SpChol():
+	SpOrder(),
+	_Parent(NULL),_LPtr(NULL),_LIdx(NULL),_LVal(NULL),_LNz(0),
+	_X(NULL),_Stack(NULL),_Flag(NULL),_Next(NULL)
+	{};
+
+	//Variable Destructor (Memory is Released by CleanTmp)
+	~SpChol(){};
+
+	//////End of Constrcutors & Destructors
+
+
+
+	//////Content Operation (These Functions Work on Itself)
+
+	//Release All Memory
+	void CleanTmp()
+	{
+#if _HEAPSCOPE
+		if(_IsAnalyzed)
+		{
+			MiniMat_HeapScope._HeapMinus(_Byte);
+		}
+#endif
+		_Free(_Perm,sizeof(u16)*((u32) _Row));
+		_Free(_PInv,sizeof(u16)*((u32) _Row));
+		_Free(_Parent,sizeof(u16)*((u32) _Row));
+		_Free(_LPtr,sizeof(u32)*(((u32) _Row)+1));
+		_Free(_LIdx,sizeof(u16)*_LNz);
+		_Free(_LVal,sizeof(Type)*_LNz);
+		_Free(_X,sizeof(Type)*((u32) _Row));
+		_Free(_Stack,sizeof(u16)*((u32) _Row));
+		_Free(_Flag,sizeof(u16)*((u32) _Row));
+		_Free(_Next,sizeof(u32)*((u32) _Row));
+		_Perm=NULL;
+		_PInv=NULL;
+		_Parent=NULL;
+		_LPtr=NULL;
+		_LIdx=NULL;
+		_LVal=NULL;
+		_X=NULL;
+		_Stack=NULL;
+		_Flag=NULL;
+		_Next=NULL;
+		_LNz=0;
+		_IsAnalyzed=0;
+		_IsFactored=0;
+		return;
+	}
+
+	//Symbolic Analysis (Ordering, Elimination Tree and Storage of L), Only the Pattern of A is Used
+	bool Analyze(SpMat<Type> &CalcSp)
+	{
+		CleanTmp();
+		if(CalcSp.Ro()!=CalcSp.Co())
+		{
+			return 0;
+		}
+
+		_Order(CalcSp.Ro(),CalcSp.PtrPt(),CalcSp.IdxPt());
+		_Parent=(u16 *) _Alloc(sizeof(u16)*((u32) _Row));
+		_LPtr=(u32 *) _Alloc(sizeof(u32)*(((u32) _Row)+1));
+		_X=(Type *) _Alloc(sizeof(Type)*((u32) _Row));
+		_Stack=(u16 *) _Alloc(sizeof(u16)*((u32) _Row));
+		_Flag=(u16 *) _Alloc(sizeof(u16)*((u32) _Row));
+		_Next=(u32 *) _Alloc(sizeof(u32)*((u32) _Row));
+
+		//Elimination Tree of the Permuted Matrix (Ancestors with Path Compression in _Stack)
+		u16 ii,kk,Node,Ancestor,Line,Top;
+		u32 pp;
+		for(kk=0;kk<_Row;kk++)
+		{
+			*(_Parent+kk)=_SPARSE_NONE;
+			*(_Stack+kk)=_SPARSE_NONE;
+			Line=*(_Perm+kk);
+			for(pp=*(CalcSp.PtrPt()+Line);pp<*(CalcSp.PtrPt()+Line+1);pp++)
+			{
+				Node=*(_PInv+*(CalcSp.IdxPt()+pp));
+				while((Node!=_SPARSE_NONE)&&(Node<kk))
+				{
+					Ancestor=*(_Stack+Node);
+					*(_Stack+Node)=kk;
+					if(Ancestor==_SPARSE_NONE)
+					{
+						*(_Parent+Node)=kk;
+					}
+					Node=Ancestor;
+				}
+			}
+		}
+
+		//Column Counts of L from Row Patterns
+		for(ii=0;ii<_Row;ii++)
+		{
+			*(_Next+ii)=1;
+			*(_Flag+ii)=_SPARSE_NONE;
+		}
+		for(kk=0;kk<_Row;kk++)
+		{
+			for(Top=_Reach(CalcSp,kk);Top<_Row;Top++)
+			{
+				(*(_Next+*(_Stack+Top)))++;
+			}
+		}
+		*_LPtr=0;
+		for(ii=0;ii<_Row;ii++)
+		{
+			*(_LPtr+ii+1)=*(_LPtr+ii)+*(_Next+ii);
+		}
+		_LNz=*(_LPtr+_Row);
+		_LIdx=(u16 *) _Alloc(sizeof(u16)*_LNz);
+		_LVal=(Type *) _Alloc(sizeof(Type)*_LNz);
+
+#if _HEAPSCOPE
+		MiniMat_HeapScope._HeapPlus(_Byte);
+#endif
+		_IsAnalyzed=1;
+		return 1;
+	}
+
+	//Numeric Factorization A=P'*L*L'*P (Same Pattern as Analyzed, Return 0 if not Positive Definite, Size Differs or Pattern does not Fit)
+	bool Factor(SpMat<Type> &CalcSp)
+	{
+		if((!_IsAnalyzed)||(CalcSp.Ro()!=_Row)||(CalcSp.Co()!=_Row))
+		{
+			return 0;
+		}
+		_IsFactored=0;
+
+		u16 ii,kk,Node,Line,Top;
+		u32 pp,Slot;
+		Type Diag,LVal;
+		for(ii=0;ii<_Row;ii++)
+		{
+			*(_Next+ii)=*(_LPtr+ii);
+			*(_Flag+ii)=_SPARSE_NONE;
+			*(_X+ii)=0;
+		}
+
+		for(kk=0;kk<_Row;kk++)
+		{
+			Top=_Reach(CalcSp,kk);
+			Line=*(_Perm+kk);
+			for(pp=*(CalcSp.PtrPt()+Line);pp<*(CalcSp.PtrPt()+Line+1);pp++)
+			{
+				Node=*(_PInv+*(CalcSp.IdxPt()+pp));
+				if(Node<=kk)
+				{
+					*(_X+Node)+=*(CalcSp.Pt()+pp);
+				}
+			}
+			Diag=*(_X+kk);
+			*(_X+kk)=0;
+			for(;Top<_Row;Top++)
+			{
+				Node=*(_Stack+Top);
+				LVal=(*(_X+Node))/(*(_LVal+*(_LPtr+Node)));
+				*(_X+Node)=0;
+				for(pp=*(_LPtr+Node)+1;pp<*(_Next+Node);pp++)
+				{
+					*(_X+*(_LIdx+pp))-=(*(_LVal+pp))*LVal;
+				}
+				Diag-=LVal*LVal;
+				Slot=*(_Next+Node);
+				if(Slot>=*(_LPtr+Node+1))
+				{
+					return 0;
+				}
+				(*(_Next+Node))++;
+				*(_LIdx+Slot)=kk;
+				*(_LVal+Slot)=LVal;
+			}
+			if(Diag<=0)
+			{
+				return 0;
+			}
+			Slot=*(_Next+kk);
+			if(Slot>=*(_LPtr+kk+1))
+			{
+				return 0;
+			}
+			(*(_Next+kk))++;
+			*(_LIdx+Slot)=kk;
+			*(_LVal+Slot)=sqrt(Diag);
+		}
+
+		_IsFactored=1;
+		return 1;
+	}
+
+	//Solve A*x=b in Place (Return 0 if not Factorized)
+	bool Solve(Type *Rhs)
+	{
+		if(!_IsFactored)
+		{
+			return 0;
+		}
+
+		u16 ii,kk;
+		u32 pp;
+		for(ii=0;ii<_Row;ii++)
+		{
+			*(_X+ii)=*(Rhs+*(_Perm+ii));
+		}
+		for(kk=0;kk<_Row;kk++)
+		{
+			*(_X+kk)/=*(_LVal+*(_LPtr+kk));
+			for(pp=*(_LPtr+kk)+1;pp<*(_LPtr+kk+1);pp++)
+			{
+				*(_X+*(_LIdx+pp))-=(*(_LVal+pp))*(*(_X+kk));
+			}
+		}
+		for(kk=_Row;kk>0;kk--)
+		{
+			for(pp=*(_LPtr+kk-1)+1;pp<*(_LPtr+kk);pp++)
+			{
+				*(_X+kk-1)-=(*(_LVal+pp))*(*(_X+*(_LIdx+pp)));
+			}
+			*(_X+kk-1)/=*(_LVal+*(_LPtr+kk-1));
+		}
+		for(ii=0;ii<_Row;ii++)
+		{
+			*(Rhs+*(_Perm+ii))=*(_X+ii);
+			*(_X+ii)=0;
+		}
+		return 1;
+	}
+
+	//FeedBack Number of Nonzeros of L
+	u32 Nz()
+	{
+		return _LNz;
+	}
+
+	//////End of Content operation
+
+};
+
+
+
+template <class Type>
+
+class SpLU : public SpOrder
+{
+
+protected://Variables (None of the variables can be directly accessed)
+
+	u32 *_LPtr;//Column Start of L (Unit Diagonal First)
+	u16 *_LIdx;//Row Index of L (Pivot Order)
+	Type *_LVal;//Value of L
+	u32 *_UPtr;//Column Start of U (Diagonal Last)
+	u16 *_UIdx;//Row Index of U (Pivot Order)
+	Type *_UVal;//Value of U
+	u32 _Cap;//Capacity of Nonzeros of L and U Each
+	u32 _Nnz;//Capacity of Nonzeros of the CSC Copy of A
+
+	u16 *_RInv;//Pivot Order of Each Original Row
+	Type *_X;//Dense Work Vector
+	u16 *_Work;//Reach Stack and Depth First Search Stack
+	u32 *_Pos;//Depth First Search Position
+	u16 *_Flag;//Visited Flag
+	Type *_AVal;//CSC Copy of A (Values)
+	u16 *_AIdx;//CSC Copy of A (Row Indexes)
+	u32 *_APtr;//CSC Copy of A (Column Starts)
+
+	//Nonzero Pattern of L\A(:,Col) in Topological Order (Depth First Search, Result in _Work[Top..Row))
+	u16 _Reach(SpMat<Type> &CalcCsc, u16 Col, u16 K)
+	{
+		u16 Top=_Row;
+		u16 Head,Node,Pivot;
+		u32 pp,qq,End;
+		bool Done;
+		u16 *Stack=_Work+_Row;
+		for(qq=*(CalcCsc.PtrPt()+Col);qq<*(CalcCsc.PtrPt()+Col+1);qq++)
+		{
+			if(*(_Flag+*(CalcCsc.IdxPt()+qq))==K)
+			{
+				continue;
+			}
+			Head=0;
+			*Stack=*(CalcCsc.IdxPt()+qq);
+			while(Head!=_SPARSE_NONE)
+			{
+				Node=*(Stack+Head);
+				Pivot=*(_RInv+Node);
+				if(*(_Flag+Node)!=K)
+				{
+					*(_Flag+Node)=K;
+					*(_Pos+Head)=(Pivot==_SPARSE_NONE)?0:(*(_LPtr+Pivot)+1);
+				}
+				Done=1;
+				End=(Pivot==_SPARSE_NONE)?0:*(_LPtr+Pivot+1);
+				for(pp=*(_Pos+Head);pp<End;pp++)
+				{
+					if(*(_Flag+*(_LIdx+pp))!=K)
+					{
+						*(_Pos+Head)=pp+1;
+						Head++;
+						*(Stack+Head)=*(_LIdx+pp);
+						Done=0;
+						break;
+					}
+				}
+				if(Done)
+				{
+					Head=(Head==0)?_SPARSE_NONE:(Head-1);
+					Top--;
+					*(_Work+Top)=Node;
+				}
+			}
+		}
+		return Top;
+	}
+
+	//Sort Row Indexes of Each Column of U (Insertion Sort, Diagonal Goes Last)
+	void _SortU()
+	{
+		u16 kk,KeyIdx;
+		u32 ii,jj;
+		Type KeyVal;
+		for(kk=0;kk<_Row;kk++)
+		{
+			for(ii=*(_UPtr+kk)+1;ii<*(_UPtr+kk+1);ii++)
+			{
+				KeyIdx=*(_UIdx+ii);
+				KeyVal=*(_UVal+ii);
+				jj=ii;
+				while((jj>*(_UPtr+kk))&&(*(_UIdx+jj-1)>KeyIdx))
+				{
+					*(_UIdx+jj)=*(_UIdx+jj-1);
+					*(_UVal+jj)=*(_UVal+jj-1);
+					jj--;
+				}
+				*(_UIdx+jj)=KeyIdx;
+				*(_UVal+jj)=KeyVal;
+			}
+		}
+	}
+
+
+
+public://Functions
+
+	//////Constrcutors & Destructors
+
+	//Empty Solver Constructor
+	explicit SpLU():
+	SpOrder(),
+	_LPtr(NULL),_LIdx(NULL),_LVal(NULL),_UPtr(NULL),_UIdx(NULL),_UVal(NULL),_Cap(0),_Nnz(0),
+	_RInv(NULL),_X(NULL),_Work(NULL),_Pos(NULL),_Flag(NULL),_AVal(NULL),_AIdx(NULL),_APtr(NULL)
+	{};
+
+	//Variable Destructor (Memory is Released by CleanTmp)
+	~SpLU(){};
+
+	//////End of Constrcutors & Destructors
+
+
+
+	//////Content Operation (These Functions Work on Itself)
+
+	//Release All Memory
+	void CleanTmp()
+	{
+#if _HEAPSCOPE
+		if(_IsAnalyzed)
+		{
+			MiniMat_HeapScope._HeapMinus(_Byte);
+		}
+#endif
+		_Free(_Perm,sizeof(u16)*((u32) _Row));
+		_Free(_PInv,sizeof(u16)*((u32) _Row));
+		_Free(_LPtr,sizeof(u32)*(((u32) _Row)+1));
+		_Free(_LIdx,sizeof(u16)*_Cap);
+		_Free(_LVal,sizeof(Type)*_Cap);
+		_Free(_UPtr,sizeof(u32)*(((u32) _Row)+1));
+		_Free(_UIdx,sizeof(u16)*_Cap);
+		_Free(_UVal,sizeof(Type)*_Cap);
+		_Free(_RInv,sizeof(u16)*((u32) _Row));
+		_Free(_X,sizeof(Type)*((u32) _Row));
+		_Free(_Work,sizeof(u16)*2*((u32) _Row));
+		_Free(_Pos,sizeof(u32)*((u32) _Row));
+		_Free(_Flag,sizeof(u16)*((u32) _Row));
+		_Free(_AVal,sizeof(Type)*_Nnz);
+		_Free(_AIdx,sizeof(u16)*_Nnz);
+		_Free(_APtr,sizeof(u32)*_SPARSE_PTRNUM(_Row,_Row));
+		_Perm=NULL;
+		_PInv=NULL;
+		_LPtr=NULL;
+		_LIdx=NULL;
+		_LVal=NULL;
+		_UPtr=NULL;
+		_UIdx=NULL;
+		_UVal=NULL;
+		_RInv=NULL;
+		_X=NULL;
+		_Work=NULL;
+		_Pos=NULL;
+		_Flag=NULL;
+		_AVal=NULL;
+		_AIdx=NULL;
+		_APtr=NULL;
+		_Cap=0;
+		_Nnz=0;
+		_IsAnalyzed=0;
+		_IsFactored=0;
+		return;
+	}
+
+	//Symbolic Analysis (Column Ordering and Storage of L and U), Only the Pattern of A is Used
+	bool Analyze(SpMat<Type> &CalcSp)
+	{
+		CleanTmp();
+		if(CalcSp.Ro()!=CalcSp.Co())
+		{
+			return 0;
+		}
+
+		_Order(CalcSp.Ro(),CalcSp.PtrPt(),CalcSp.IdxPt());
+
+		//Storage Estimated from Fill of Cholesky of the Same Ordering on A+A' (Exact without Off Diagonal Pivots)
+		_Nnz=CalcSp.Nz();
+		_Cap=_SymNz*_SPARSE_LU_FILL;
+		_LPtr=(u32 *) _Alloc(sizeof(u32)*(((u32) _Row)+1));
+		_LIdx=(u16 *) _Alloc(sizeof(u16)*_Cap);
+		_LVal=(Type *) _Alloc(sizeof(Type)*_Cap);
+		_UPtr=(u32 *) _Alloc(sizeof(u32)*(((u32) _Row)+1));
+		_UIdx=(u16 *) _Alloc(sizeof(u16)*_Cap);
+		_UVal=(Type *) _Alloc(sizeof(Type)*_Cap);
+		_RInv=(u16 *) _Alloc(sizeof(u16)*((u32) _Row));
+		_X=(Type *) _Alloc(sizeof(Type)*((u32) _Row));
+		_Work=(u16 *) _Alloc(sizeof(u16)*2*((u32) _Row));
+		_Pos=(u32 *) _Alloc(sizeof(u32)*((u32) _Row));
+		_Flag=(u16 *) _Alloc(sizeof(u16)*((u32) _Row));
+		_AVal=(Type *) _Alloc(sizeof(Type)*_Nnz);
+		_AIdx=(u16 *) _Alloc(sizeof(u16)*_Nnz);
+		_APtr=(u32 *) _Alloc(sizeof(u32)*_SPARSE_PTRNUM(_Row,_Row));
+
+#if _HEAPSCOPE
+		MiniMat_HeapScope._HeapPlus(_Byte);
+#endif
+		_IsAnalyzed=1;
+		return 1;
+	}
+
+	//Numeric Factorization P*A*Q=L*U with Threshold Partial Pivoting (Return 0 if Singular, out of Storage or Size Differs)
+	bool Factor(SpMat<Type> &CalcSp)
+	{
+		if((!_IsAnalyzed)||(CalcSp.Nz()>_Nnz))
+		{
+			return 0;
+		}
+		_IsFactored=0;
+
+		SpMat<Type> CalcCsc(_Row,_Row,_Nnz,_AVal,_AIdx,_APtr);
+		if(!Convert(CalcSp,CalcCsc,1))
+		{
+			return 0;
+		}
+
+		u16 ii,kk,Top,Col,Pivot;
+		u32 pp,LNz,UNz;
+		Type MaxVal,Mediate;
+		for(ii=0;ii<_Row;ii++)
+		{
+			*(_RInv+ii)=_SPARSE_NONE;
+			*(_Flag+ii)=_SPARSE_NONE;
+			*(_X+ii)=0;
+		}
+
+		LNz=0;
+		UNz=0;
+		for(kk=0;kk<_Row;kk++)
+		{
+			*(_LPtr+kk)=LNz;
+			*(_UPtr+kk)=UNz;
+			//Column kk of L Holds at Most the _Row-kk Unpivoted Rows, Column kk of U at Most the kk Pivoted Rows and the Diagonal
+			if((LNz+_Row-kk>_Cap)||(UNz+kk+1>_Cap))
+			{
+				return 0;
+			}
+
+			//Sparse Triangular Solve x=L\A(:,Col)
+			Col=*(_Perm+kk);
+			Top=_Reach(CalcCsc,Col,kk);
+			for(pp=*(CalcCsc.PtrPt()+Col);pp<*(CalcCsc.PtrPt()+Col+1);pp++)
+			{
+				*(_X+*(CalcCsc.IdxPt()+pp))=*(CalcCsc.Pt()+pp);
+			}
+			for(ii=Top;ii<_Row;ii++)
+			{
+				Pivot=*(_RInv+*(_Work+ii));
+				if(Pivot==_SPARSE_NONE)
+				{
+					continue;
+				}
+				Mediate=*(_X+*(_Work+ii));
+				for(pp=*(_LPtr+Pivot)+1;pp<*(_LPtr+Pivot+1);pp++)
+				{
+					*(_X+*(_LIdx+pp))-=(*(_LVal+pp))*Mediate;
+				}
+			}
+
+			//Choose Pivot (Diagonal Preferred)
+			Pivot=_SPARSE_NONE;
+			MaxVal=0;
+			for(ii=Top;ii<_Row;ii++)
+			{
+				if(*(_RInv+*(_Work+ii))==_SPARSE_NONE)
+				{
+					if(fabs(*(_X+*(_Work+ii)))>MaxVal)
+					{
+						MaxVal=fabs(*(_X+*(_Work+ii)));
+						Pivot=*(_Work+ii);
+					}
+				}
+				else
+				{
+					*(_UIdx+UNz)=*(_RInv+*(_Work+ii));
+					*(_UVal+UNz)=*(_X+*(_Work+ii));
+					UNz++;
+				}
+			}
+			if((Pivot==_SPARSE_NONE)||(MaxVal<=0))
+			{
+				return 0;
+			}
+			if((*(_RInv+Col)==_SPARSE_NONE)&&(*(_Flag+Col)==kk)&&(fabs(*(_X+Col))>=MaxVal*_SPARSE_LU_TOL))
+			{
+				Pivot=Col;
+			}
+
+			Mediate=*(_X+Pivot);
+			*(_UIdx+UNz)=kk;
+			*(_UVal+UNz)=Mediate;
+			UNz++;
+			*(_RInv+Pivot)=kk;
+			*(_LIdx+LNz)=Pivot;
+			*(_LVal+LNz)=1;
+			LNz++;
+			for(ii=Top;ii<_Row;ii++)
+			{
+				if(*(_RInv+*(_Work+ii))==_SPARSE_NONE)
+				{
+					*(_LIdx+LNz)=*(_Work+ii);
+					*(_LVal+LNz)=(*(_X+*(_Work+ii)))/Mediate;
+					LNz++;
+				}
+				*(_X+*(_Work+ii))=0;
+			}
+		}
+		*(_LPtr+_Row)=LNz;
+		*(_UPtr+_Row)=UNz;
+
+		//Row Indexes of L to Pivot Order
+		for(pp=0;pp<LNz;pp++)
+		{
+			*(_LIdx+pp)=*(_RInv+*(_LIdx+pp));
+		}
+		_SortU();
+
+		_IsFactored=1;
+		return 1;
+	}
+
+	//Numeric Refactorization with the Pivots and Patterns of the Last Factor (Return 0 if a Zero Pivot Appears or Size Differs)
+	bool Refactor(SpMat<Type> &CalcSp)
+	{
+		if((!_IsFactored)||(CalcSp.Nz()>_Nnz))
+		{
+			return 0;
+		}
+		_IsFactored=0;
+
+		SpMat<Type> CalcCsc(_Row,_Row,_Nnz,_AVal,_AIdx,_APtr);
+		if(!Convert(CalcSp,CalcCsc,1))
+		{
+			return 0;
+		}
+
+		u16 kk,Col,Row;
+		u32 pp,qq;
+		Type Mediate;
+		for(kk=0;kk<_Row;kk++)
+		{
+			Col=*(_Perm+kk);
+			for(pp=*(CalcCsc.PtrPt()+Col);pp<*(CalcCsc.PtrPt()+Col+1);pp++)
+			{
+				*(_X+*(_RInv+*(CalcCsc.IdxPt()+pp)))=*(CalcCsc.Pt()+pp);
+			}
+			for(pp=*(_UPtr+kk);pp+1<*(_UPtr+kk+1);pp++)
+			{
+				Row=*(_UIdx+pp);
+				Mediate=*(_X+Row);
+				*(_UVal+pp)=Mediate;
+				*(_X+Row)=0;
+				for(qq=*(_LPtr+Row)+1;qq<*(_LPtr+Row+1);qq++)
+				{
+					*(_X+*(_LIdx+qq))-=(*(_LVal+qq))*Mediate;
+				}
+			}
+			Mediate=*(_X+kk);
+			*(_X+kk)=0;
+			if(Mediate==0)
+			{
+				return 0;
+			}
+			*(_UVal+*(_UPtr+kk+1)-1)=Mediate;
+			for(pp=*(_LPtr+kk)+1;pp<*(_LPtr+kk+1);pp++)
+			{
+				*(_LVal+pp)=(*(_X+*(_LIdx+pp)))/Mediate;
+				*(_X+*(_LIdx+pp))=0;
+			}
+		}
+
+		_IsFactored=1;
+		return 1;
+	}
+
+	//Solve A*x=b in Place (Return 0 if not Factorized)
+	bool Solve(Type *Rhs)
+	{
+		if(!_IsFactored)
+		{
+			return 0;
+		}
+
+		u16 ii,kk;
+		u32 pp;
+		for(ii=0;ii<_Row;ii++)
+		{
+			*(_X+*(_RInv+ii))=*(Rhs+ii);
+		}
+		for(kk=0;kk<_Row;kk++)
+		{
+			for(pp=*(_LPtr+kk)+1;pp<*(_LPtr+kk+1);pp++)
+			{
+				*(_X+*(_LIdx+pp))-=(*(_LVal+pp))*(*(_X+kk));
+			}
+		}
+		for(kk=_Row;kk>0;kk--)
+		{
+			*(_X+kk-1)/=*(_UVal+*(_UPtr+kk)-1);
+			for(pp=*(_UPtr+kk-1);pp+1<*(_UPtr+kk);pp++)
+			{
+				*(_X+*(_UIdx+pp))-=(*(_UVal+pp))*(*(_X+kk-1));
+			}
+		}
+		for(ii=0;ii<_Row;ii++)
+		{
+			*(Rhs+*(_Perm+ii))=*(_X+ii);
+			*(_X+ii)=0;
+		}
+		return 1;
+	}
+
+	//FeedBack Number of Nonzeros of L and U
+	u32 Nz()
+	{
+		return (_IsFactored?(*(_LPtr+_Row)+*(_UPtr+_Row)):0);
+	}
+
+	//////End of Content operation
+
+};
+
+
+#endif
@@ -0,0 +1,591 @@
+/*
+*File Name: MiniMatSparse.hpp
+*File Creation Date: October 18th 2026
+*File Final Revised Date: October 18th 2026
+*Author: Jiamin Wang
+*Description: Compressed Sparse Row/Column Matrix of MiniMat
+*/
+
+/*
+*Note:
+*SpMat stores only nonzero elements, either compressed by row (CSR) or by column (CSC).
+*SpMat uses u16 dimensions and u32 nonzero count, so it is not limited to 255 rows like Mat.
+*The storage size and capacity (maximum nonzero count) are fixed at definition, fill functions return 0 if the capacity is not enough
+*	or if the source (FromMat, Convert) has a different size.
+*Indices of the interface are 1-based like Mat, indices in the storage are 0-based.
+*Dense vectors are plain arrays; dense matrixes are row-major arrays (the same layout as Mat) or Mat when size<=255.
+*If compiled with OpenMP, CSR matrix vector multiply runs in parallel when rows are no less than _SPARSE_PARALLEL_ROW.
+*/
+
+#ifndef MINIMATSPARSE_HPP_
+#define MINIMATSPARSE_HPP_
+
+#include "MiniMat.hpp"
+
+#ifndef _SPARSE_PARALLEL_ROW
+	#define _SPARSE_PARALLEL_ROW 4096
+#endif
+
+#define _SPARSE_PTRNUM(ROW,COL) ((((u32) ROW)>((u32) COL)?((u32) ROW):((u32) COL))+1)
+
+//Define a fixed sparse matrix
+#define DefSpMat(TYPE,NAME,ROW,COL,NNZ) \
+	TYPE MACON(NAME,DEFSPVAL)[((u32) NNZ)];\
+	u16 MACON(NAME,DEFSPIDX)[((u32) NNZ)];\
+	u32 MACON(NAME,DEFSPPTR)[_SPARSE_PTRNUM(ROW,COL)];\
+	SpMat<TYPE> NAME( (u16) ROW , (u16) COL , (u32) NNZ , ((TYPE *) &(MACON(NAME,DEFSPVAL)[0])) , ((u16 *) &(MACON(NAME,DEFSPIDX)[0])) , ((u32 *) &(MACON(NAME,DEFSPPTR)[0])) );
+
+//Define a temporary sparse matrix on heap (For large systems)
+#if _HEAPSCOPE
+	#define TmpSpMat(TYPE,NAME,ROW,COL,NNZ) \
+			TYPE *MACON(NAME,TMPSPVAL)=(TYPE *) malloc(sizeof(TYPE)*((u32) NNZ));\
+			u16 *MACON(NAME,TMPSPIDX)=(u16 *) malloc(sizeof(u16)*((u32) NNZ));\
+			u32 *MACON(NAME,TMPSPPTR)=(u32 *) malloc(sizeof(u32)*_SPARSE_PTRNUM(ROW,COL));\
+			MiniMat_HeapScope._HeapPlus((sizeof(TYPE)+sizeof(u16))*((u32) NNZ)+sizeof(u32)*_SPARSE_PTRNUM(ROW,COL));\
+			SpMat<TYPE> NAME( (u16) ROW , (u16) COL , (u32) NNZ , MACON(NAME,TMPSPVAL) , MACON(NAME,TMPSPIDX) , MACON(NAME,TMPSPPTR) );\
+			NAME.SetTemp();
+#else
+	#define TmpSpMat(TYPE,NAME,ROW,COL,NNZ) \
+			TYPE *MACON(NAME,TMPSPVAL)=(TYPE *) malloc(sizeof(TYPE)*((u32) NNZ));\
+			u16 *MACON(NAME,TMPSPIDX)=(u16 *) malloc(sizeof(u16)*((u32) NNZ));\
+			u32 *MACON(NAME,TMPSPPTR)=(u32 *) malloc(sizeof(u32)*_SPARSE_PTRNUM(ROW,COL));\
+			SpMat<TYPE> NAME( (u16) ROW , (u16) COL , (u32) NNZ , MACON(NAME,TMPSPVAL) , MACON(NAME,TMPSPIDX) , MACON(NAME,TMPSPPTR) );\
+			NAME.SetTemp();
+#endif
+
+
+
+template <class Type>
+
+class SpMat
+{
+
+protected://Variables (None of the variables can be directly accessed)
+
+	bool _IsCSC;//Indicate Compressed by Column Status (CSR Otherwise)
+	bool _IsTemp;//Indicate Temperorary Status
+
+	Type *_Value;//Root Pointer of Nonzero Values
+	u16 *_Idx;//Column Index (CSR) or Row Index (CSC) of Each Nonzero
+	u32 *_Ptr;//Start of Each Row (CSR) or Column (CSC), One More for the End
+	u16 _Row;//Number of Rows
+	u16 _Col;//Number of Columns
+	u32 _Nnz;//Number of Nonzeros
+	u32 _Cap;//Capacity of Nonzeros
+
+	//Number of Compressed Lines (Rows for CSR, Columns for CSC)
+	u16 _Line()
+	{
+		return (_IsCSC?_Col:_Row);
+	}
+
+	//Sort Indexes inside Each Line and Merge Duplicates (Insertion Sort, Lines are Short)
+	void _SortMerge()
+	{
+		u32 ii,jj,Start,End,Write;
+		u16 KeyIdx;
+		Type KeyVal;
+		u16 Line=_Line();
+		u16 ll;
+
+		Write=0;
+		Start=*_Ptr;
+		for(ll=0;ll<Line;ll++)
+		{
+			End=*(_Ptr+ll+1);
+			for(ii=Start+1;ii<End;ii++)
+			{
+				KeyIdx=*(_Idx+ii);
+				KeyVal=*(_Value+ii);
+				jj=ii;
+				while((jj>Start)&&(*(_Idx+jj-1)>KeyIdx))
+				{
+					*(_Idx+jj)=*(_Idx+jj-1);
+					*(_Value+jj)=*(_Value+jj-1);
+					jj--;
+				}
+				*(_Idx+jj)=KeyIdx;
+				*(_Value+jj)=KeyVal;
+			}
+
+			*(_Ptr+ll)=Write;
+			for(ii=Start;ii<End;ii++)
+			{
+				if((Write>*(_Ptr+ll))&&(*(_Idx+Write-1)==*(_Idx+ii)))
+				{
+					*(_Value+Write-1)+=*(_Value+ii);
+				}
+				else
+				{
+					*(_Idx+Write)=*(_Idx+ii);
+					*(_Value+Write)=*(_Value+ii);
+					Write++;
+				}
+			}
+			Start=End;
+		}
+		*(_Ptr+Line)=Write;
+		_Nnz=Write;
+	}
+
+
+
+public://Functions
+
+	//////Constrcutors & Destructors
+
+	//Global Variable Constructor (Empty CSR Matrix)
+	explicit SpMat(u16 Row, u16 Col, u32 Cap, Type *Value, u16 *Idx, u32 *Ptr):
+	_IsCSC(0),_IsTemp(0),
+	_Value(Value),_Idx(Idx),_Ptr(Ptr),_Row(Row),_Col(Col),_Nnz(0),_Cap(Cap)
+	{
+		Clear();
+	};
+
+	//Variable Destructor (Designed for Regional Variable)
+	~SpMat(){};
+
+	//////End of Constrcutors & Destructors
+
+
+
+	//////Content Operation (These Functions Work on Itself)
+
+	//Set Temp Status
+	SpMat<Type> & SetTemp()
+	{
+		_IsTemp=1;
+		return *this;
+	}
+
+	//Clean Temp
+	void CleanTmp()
+	{
+		if(_IsTemp)
+		{
+#if _HEAPSCOPE
+			MiniMat_HeapScope._HeapMinus(((u32)(sizeof(Type)+sizeof(u16)))*_Cap+((u32)sizeof(u32))*_SPARSE_PTRNUM(_Row,_Col));
+#endif
+			free(_Value);
+			free(_Idx);
+			free(_Ptr);
+			_Value=NULL;
+			_Idx=NULL;
+			_Ptr=NULL;
+		}
+		return;
+	}
+
+	//Remove All Nonzeros
+	SpMat<Type> & Clear()
+	{
+		u32 ii;
+		for(ii=0;ii<_SPARSE_PTRNUM(_Row,_Col);ii++)
+		{
+			*(_Ptr+ii)=0;
+		}
+		_Nnz=0;
+		return *this;
+	}
+
+	//Compress from a Dense Matrix of the Same Size (ByCol for CSC, Return 0 if Size Differs or Capacity is not Enough, This will destroy Input Mat if is Temp Mat)
+	bool FromMat(Mat<Type> DenseMat, bool ByCol=0)
+	{
+		if((DenseMat.Ro()!=_Row)||(DenseMat.Co()!=_Col))
+		{
+			DenseMat.CleanRet();
+			return 0;
+		}
+		_IsCSC=ByCol;
+		Clear();
+
+		Type *_Ptr1;
+		u16 ii,jj;
+		u16 Line=(ByCol?_Col:_Row);
+		u16 Width=(ByCol?_Row:_Col);
+		for(ii=0;ii<Line;ii++)
+		{
+			_Ptr1=DenseMat.Pt()+(ByCol?ii:ii*_Col);
+			for(jj=0;jj<Width;jj++)
+			{
+				if(*_Ptr1!=0)
+				{
+					if(_Nnz>=_Cap)
+					{
+						DenseMat.CleanRet();
+						Clear();
+						return 0;
+					}
+					*(_Idx+_Nnz)=jj;
+					*(_Value+_Nnz)=*_Ptr1;
+					_Nnz++;
+				}
+				_Ptr1+=(ByCol?_Col:1);
+			}
+			*(_Ptr+ii+1)=_Nnz;
+		}
+
+		DenseMat.CleanRet();
+
+		return 1;
+	}
+
+	//Compress from a Triplet List of 1-based (Row,Col,Value), Duplicates are Summed (Return 0 if Capacity is not Enough)
+	bool FromTriplet(u32 Num, u16 *Rows, u16 *Cols, Type *Vals, bool ByCol=0)
+	{
+		_IsCSC=ByCol;
+		Clear();
+		if(Num>_Cap)
+		{
+			return 0;
+		}
+
+		u16 *Major=(ByCol?Cols:Rows);
+		u16 *Minor=(ByCol?Rows:Cols);
+		u16 Line=_Line();
+		u32 ii,Dest;
+
+		for(ii=0;ii<Num;ii++)
+		{
+			(*(_Ptr+*(Major+ii)))++;
+		}
+		for(ii=0;ii<Line;ii++)
+		{
+			*(_Ptr+ii+1)+=*(_Ptr+ii);
+		}
+		for(ii=0;ii<Num;ii++)
+		{
+			Dest=*(_Ptr+*(Major+ii)-1);
+			*(_Idx+Dest)=*(Minor+ii)-1;
+			*(_Value+Dest)=*(Vals+ii);
+			(*(_Ptr+*(Major+ii)-1))++;
+		}
+		for(ii=Line;ii>0;ii--)
+		{
+			*(_Ptr+ii)=*(_Ptr+ii-1);
+		}
+		*_Ptr=0;
+
+		_SortMerge();
+
+		return 1;
+	}
+
+	//Convert Compression Direction into Another Sparse Matrix of the Same Size (CSR<->CSC, Return 0 if Size Differs or Capacity is not Enough)
+	friend bool Convert(SpMat<Type> &From, SpMat<Type> &To, bool ByCol)
+	{
+		if((From._Row!=To._Row)||(From._Col!=To._Col))
+		{
+			return 0;
+		}
+		To._IsCSC=ByCol;
+		To.Clear();
+		if(From._Nnz>To._Cap)
+		{
+			return 0;
+		}
+
+		u32 ii,Dest;
+		u16 ll;
+		u16 FromLine=From._Line();
+		u16 ToLine=To._Line();
+		if(From._IsCSC==ByCol)
+		{
+			for(ii=0;ii<=FromLine;ii++)
+			{
+				*(To._Ptr+ii)=*(From._Ptr+ii);
+			}
+			for(ii=0;ii<From._Nnz;ii++)
+			{
+				*(To._Idx+ii)=*(From._Idx+ii);
+				*(To._Value+ii)=*(From._Value+ii);
+			}
+			To._Nnz=From._Nnz;
+			return 1;
+		}
+
+		for(ii=0;ii<From._Nnz;ii++)
+		{
+			(*(To._Ptr+*(From._Idx+ii)+1))++;
+		}
+		for(ii=0;ii<ToLine;ii++)
+		{
+			*(To._Ptr+ii+1)+=*(To._Ptr+ii);
+		}
+		for(ll=0;ll<FromLine;ll++)
+		{
+			for(ii=*(From._Ptr+ll);ii<*(From._Ptr+ll+1);ii++)
+			{
+				Dest=*(To._Ptr+*(From._Idx+ii));
+				*(To._Idx+Dest)=ll;
+				*(To._Value+Dest)=*(From._Value+ii);
+				(*(To._Ptr+*(From._Idx+ii)))++;
+			}
+		}
+		for(ii=ToLine;ii>0;ii--)
+		{
+			*(To._Ptr+ii)=*(To._Ptr+ii-1);
+		}
+		*To._Ptr=0;
+		To._Nnz=From._Nnz;
+
+		return 1;
+	}
+
+	//Print the Matrix on Console (Dense View)
+#if !_MICROCHIP
+	void Print()
+	{
+		cout<<endl;
+		u16 ii,jj;
+		for(ii=1;ii<=_Row;ii++)
+		{
+			for(jj=1;jj<=_Col;jj++)
+			{
+				cout<<Val(ii,jj)<<"\t";
+			}
+			cout<<endl;
+		}
+	}
+#endif
+
+	//////End of Content operation
+
+
+
+	//////Self Interaction (These functions, if correctly used, generates new things)
+
+	//FeedBack RowNum
+	u16 Ro()
+	{
+		return _Row;
+	}
+
+	//FeedBack ColNum
+	u16 Co()
+	{
+		return _Col;
+	}
+
+	//FeedBack Number of Nonzeros
+	u32 Nz()
+	{
+		return _Nnz;
+	}
+
+	//FeedBack Memory Space
+	u32 Sp()
+	{
+		return ((u32)(sizeof(Type)+sizeof(u16)))*_Cap+((u32)sizeof(u32))*_SPARSE_PTRNUM(_Row,_Col);
+	}
+
+	//FeedBack Compressed by Column Status
+	bool CSC()
+	{
+		return _IsCSC;
+	}
+
+	//FeedBack Start of Each Row (CSR) or Column (CSC), Used by Other MiniMat Types
+	u32 * PtrPt()
+	{
+		return _Ptr;
+	}
+
+	//FeedBack Index of Each Nonzero, Used by Other MiniMat Types
+	u16 * IdxPt()
+	{
+		return _Idx;
+	}
+
+	//FeedBack Value of Each Nonzero, Used by Other MiniMat Types
+	Type * Pt()
+	{
+		return _Value;
+	}
+
+	//Extract Single Value (1-based, Return 0 if not Stored)
+	Type Val(u16 Row, u16 Col)
+	{
+		u16 Major=(_IsCSC?Col:Row)-1;
+		u16 Minor=(_IsCSC?Row:Col)-1;
+		u32 ii;
+		for(ii=*(_Ptr+Major);ii<*(_Ptr+Major+1);ii++)
+		{
+			if(*(_Idx+ii)==Minor)
+			{
+				return *(_Value+ii);
+			}
+		}
+		return 0;
+	}
+
+	//Expand to Dense Matrix (Size<=255)
+	Mat<Type> Full()
+	{
+		RetMat(Type,NewMat,_Row,_Col);
+		NewMat=0;
+
+		u16 ll;
+		u32 ii;
+		for(ll=0;ll<_Line();ll++)
+		{
+			for(ii=*(_Ptr+ll);ii<*(_Ptr+ll+1);ii++)
+			{
+				if(_IsCSC)
+				{
+					*(NewMat.Pt()+(*(_Idx+ii))*_Col+ll)=*(_Value+ii);
+				}
+				else
+				{
+					*(NewMat.Pt()+ll*_Col+*(_Idx+ii))=*(_Value+ii);
+				}
+			}
+		}
+
+		return NewMat;
+	}
+
+	//Calculate Sparse Matrix Vector Multiply Out=A*In (Parallel CSR for Large Row Counts)
+	void Mult(Type *In, Type *Out)
+	{
+		if(_IsCSC)
+		{
+			u16 ii,jj;
+			u32 kk;
+			Type Mediate;
+			for(ii=0;ii<_Row;ii++)
+			{
+				*(Out+ii)=0;
+			}
+			for(jj=0;jj<_Col;jj++)
+			{
+				Mediate=*(In+jj);
+				if(Mediate!=0)
+				{
+					for(kk=*(_Ptr+jj);kk<*(_Ptr+jj+1);kk++)
+					{
+						*(Out+*(_Idx+kk))+=(*(_Value+kk))*Mediate;
+					}
+				}
+			}
+		}
+		else
+		{
+			s32 ii;
+			u32 kk;
+			Type MultSum;
+#ifdef _OPENMP
+			#pragma omp parallel for private(kk,MultSum) schedule(static) if(_Row>=_SPARSE_PARALLEL_ROW)
+#endif
+			for(ii=0;ii<(s32)_Row;ii++)
+			{
+				MultSum=0;
+				for(kk=*(_Ptr+ii);kk<*(_Ptr+ii+1);kk++)
+				{
+					MultSum+=(*(_Value+kk))*(*(In+*(_Idx+kk)));
+				}
+				*(Out+ii)=MultSum;
+			}
+		}
+		return;
+	}
+
+	//Calculate Transposed Sparse Matrix Vector Multiply Out=A'*In (Matrix is not Modified, Parallel CSC for Large Column Counts)
+	void MultTrans(Type *In, Type *Out)
+	{
+		if(_IsCSC)
+		{
+			s32 jj;
+			u32 kk;
+			Type MultSum;
+#ifdef _OPENMP
+			#pragma omp parallel for private(kk,MultSum) schedule(static) if(_Col>=_SPARSE_PARALLEL_ROW)
+#endif
+			for(jj=0;jj<(s32)_Col;jj++)
+			{
+				MultSum=0;
+				for(kk=*(_Ptr+jj);kk<*(_Ptr+jj+1);kk++)
+				{
+					MultSum+=(*(_Value+kk))*(*(In+*(_Idx+kk)));
+				}
+				*(Out+jj)=MultSum;
+			}
+		}
+		else
+		{
+			u16 ii,jj;
+			u32 kk;
+			Type Mediate;
+			for(jj=0;jj<_Col;jj++)
+			{
+				*(Out+jj)=0;
+			}
+			for(ii=0;ii<_Row;ii++)
+			{
+				Mediate=*(In+ii);
+				if(Mediate!=0)
+				{
+					for(kk=*(_Ptr+ii);kk<*(_Ptr+ii+1);kk++)
+					{
+						*(Out+*(_Idx+kk))+=(*(_Value+kk))*Mediate;
+					}
+				}
+			}
+		}
+		return;
+	}
+
+	//Calculate Sparse Dense Multiply Out=A*In with Row-Major Dense Matrixes of Num Columns
+	void Mult(Type *In, u16 Num, Type *Out)
+	{
+		u32 ii;
+		for(ii=0;ii<((u32)_Row)*Num;ii++)
+		{
+			*(Out+ii)=0;
+		}
+
+		u16 ll,jj;
+		u32 kk;
+		Type Scale;
+		Type *_Ptr1,*_Ptr2;
+		for(ll=0;ll<_Line();ll++)
+		{
+			for(kk=*(_Ptr+ll);kk<*(_Ptr+ll+1);kk++)
+			{
+				Scale=*(_Value+kk);
+				if(_IsCSC)
+				{
+					_Ptr1=Out+((u32)*(_Idx+kk))*Num;
+					_Ptr2=In+((u32)ll)*Num;
+				}
+				else
+				{
+					_Ptr1=Out+((u32)ll)*Num;
+					_Ptr2=In+((u32)*(_Idx+kk))*Num;
+				}
+				for(jj=0;jj<Num;jj++)
+				{
+					*(_Ptr1+jj)+=Scale*(*(_Ptr2+jj));
+				}
+			}
+		}
+		return;
+	}
+
+	//Calculate Sparse Dense Multiply (Size<=255, This will destroy Input Mat if is Temp Mat)
+	friend Mat<Type> operator*(SpMat<Type> &CalcSp, Mat<Type> CalcMat)
+	{
+		RetMat(Type,NewMat,CalcSp._Row,CalcMat.Co());
+		CalcSp.Mult(CalcMat.Pt(),CalcMat.Co(),NewMat.Pt());
+
+		CalcMat.CleanRet();
+
+		return NewMat;
+	}
+
+	//////End of Self Interaction
+
+};
+
+
+#endif